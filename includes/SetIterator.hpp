@@ -11,8 +11,8 @@ namespace ft
 	{
 	public :
 		typedef const T																																			value_type;
-		typedef typename ft::choose<B, const T*, T*>::type																	pointer;
-		typedef typename ft::choose<B, const T&, T&>::type																	reference;
+		typedef const T*																																		pointer;	// Elements of a set are keys,
+		typedef const T&																																		reference;	// so both iterators are read-only.
 		typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::difference_type		difference_type;
 		typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::iterator_category	iterator_category;
 		typedef ft::RBTreeNode<T>																														node_type;
@@ -27,15 +27,15 @@ namespace ft
 		/**
 		 * @brief Operators
 		 */
-		reference operator*() const { return *_node->value; }
-		pointer operator->() const { return _node->value; }
+		reference operator*() const { return _node->value; }
+		pointer operator->() const { return &_node->value; }
 
 		SetIterator& operator++() {
 			node_type* tmp = ft_nullptr;
-			if (_node->right_child->value != ft_nullptr) {	// if right_child exists,
+			if (!_node->right_child->is_nil()) {	// if right_child exists,
 				tmp = _node->right_child;
 				// search the leftmost of the right_child.
-				while (tmp->left_child->value != ft_nullptr)
+				while (!tmp->left_child->is_nil())
 					tmp = tmp->left_child;
 			}
 			else {	// if right_child doesn't exist,
@@ -53,12 +53,12 @@ namespace ft
 
 		SetIterator& operator--() {
 			node_type* tmp = ft_nullptr;
-			if (_node->value == ft_nullptr)
+			if (_node->is_nil())
 				tmp = _node->parent;
-			else if (_node->left_child->value != ft_nullptr) {	// if left_child exists,
+			else if (!_node->left_child->is_nil()) {	// if left_child exists,
 				tmp = _node->left_child;
 				// search the rightmost of the left_child.
-				while (tmp->right_child->value != ft_nullptr)
+				while (!tmp->right_child->is_nil())
 					tmp = tmp->right_child;
 			}
 			else {	// if left_child doesn't exist,
@@ -3,6 +3,7 @@
 
 #include <stdexcept>
 #include "SetIterator.hpp"
+#include "pool_allocator.hpp"
 
 namespace ft
 {
@@ -10,79 +11,87 @@ namespace ft
 	 * @brief SetTree class
 	 * set base - red black tree
 	 * 
-	 * @tparam T				value_type (pair of key and mapped_type)
-	 * @tparam Compare	A binary predicate that takes two element keys as arguments and returns a bool.
-	 * @tparam Alloc		Type of the allocator object used to define the storage allocation model.
+	 * @tparam Key				key_type
+	 * @tparam T					value_type (pair of key and mapped_type)
+	 * @tparam KeyOfValue	A function object that returns the key stored in a value_type.
+	 * @tparam Compare		A binary predicate that takes two element keys as arguments and returns a bool.
+	 * @tparam Alloc			Type of the allocator object used to define the storage allocation model.
 	 */
-	template < typename T, typename Compare = ft::less<T>, typename Alloc = std::allocator<T> >
+	template < typename Key, typename T, typename KeyOfValue,
+						typename Compare = ft::less<Key>, typename Alloc = std::allocator<T> >
 	class SetTree {
 	public :
 		/**
 		 * @brief Member types
 		 */
+		typedef Key																								key_type;
 		typedef T																									value_type;
 		typedef T*																								pointer;
 		typedef const T*																					const_pointer;
 		typedef T&																								reference;
 		typedef const T&																					const_reference;
-		typedef Compare																						value_comp;
+		typedef Compare																						key_compare;
 		typedef Alloc																							allocator_type;
 		typedef size_t																						size_type;
 		typedef ft::RBTreeNode<T>																	node_type;
 		typedef typename ft::SetIterator<T, false>								iterator;
 		typedef typename ft::SetIterator<T, true>									const_iterator;
 		typedef typename Alloc::template rebind<node_type>::other node_allocator_type;
+		typedef ft::three_way<Compare>														three_way_compare;
 
 		/**
 		 * @brief Member functions
 		 */
-		// Default constructor
-		SetTree() : _root(ft_nullptr), _nil(ft_nullptr), _size(0),
-							_comp(value_comp()), _node_alloc(node_allocator_type()) {
+		// Default constructor, the nodes come from alloc rebound to node_type.
+		explicit SetTree(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+							: _root(ft_nullptr), _nil(ft_nullptr), _leftmost(ft_nullptr), _rightmost(ft_nullptr), _size(0),
+							_comp(comp), _alloc(alloc), _node_alloc(alloc) {
 			_nil = make_nil();
 			_root = _nil;
+			_leftmost = _nil;
+			_rightmost = _nil;
 		}
 
 		// Copy constructor
-		SetTree(const SetTree& _copy) : _root(ft_nullptr), _nil(ft_nullptr), _size(0),
-																	_comp(value_comp()), _node_alloc(node_allocator_type()) {
+		SetTree(const SetTree& _copy) : _root(ft_nullptr), _nil(ft_nullptr), _leftmost(ft_nullptr), _rightmost(ft_nullptr), _size(0),
+																	_comp(_copy._comp), _alloc(_copy._alloc), _node_alloc(_copy._alloc) {
 			_nil = make_nil();
+			_root = _nil;
+			_leftmost = _nil;
+			_rightmost = _nil;
 			copy(_copy);
-			_nil->parent = get_max_value_node();
 		}
 
 		// Destructor
 		~SetTree() {
+			if (release_nodes())
+				return;
 			clear();
-			_node_alloc.destroy(_nil);
 			_node_alloc.deallocate(_nil, 1);
 		}
 
 		// Assignment operator
 		SetTree& operator=(const SetTree& x) { if (this != &x) copy(x); return *this; }
 
+		// Clones the shape and the colors of x in O(n), without comparing or rebalancing.
+		// The nodes already owned by this tree are reused before new ones are allocated.
 		void copy(const SetTree& x) {
-			clear();
-			copy(x._root);
-		}
-
-		void copy(node_type* node) {
-			if (node->value == ft_nullptr)
-				return;
-			insert(*node->value);
-			if (node->left_child->value != ft_nullptr)
-				copy(node->left_child);
-			if (node->right_child->value != ft_nullptr)
-				copy(node->right_child);
+			node_type* reuse = detach_nodes();
+			_comp = x._comp;
+			try {
+				if (x._size != 0)
+					clone(x, reuse);
+			}
+			catch (...) {
+				destroy_list(reuse);
+				clear();
+				throw;
+			}
+			destroy_list(reuse);
 		}
 
 		// Iterators:
-		node_type* get_begin() const {
-			node_type* tmp = _root;
-			while (tmp->left_child->value != ft_nullptr)
-				tmp = tmp->left_child;
-			return tmp;
-		}
+		node_type* get_begin() const { return _leftmost; }
 		node_type* get_end() const { return _nil; }
 
 		// Capacity:
@@ -90,132 +99,261 @@ namespace ft
 		size_type size() const { return _size; }
 		size_type max_size() const { return _node_alloc.max_size(); }
 
+		// Observers:
+		const key_compare& key_comp() const { return _comp; }
+		allocator_type get_allocator() const { return _alloc; }
+
 		// Element access:
 		ft::pair<node_type*, bool> insert(const value_type& val, node_type* hint = ft_nullptr) {
-			node_type* new_node = make_node(val); // Creates a node with the val value entered as an argument.
-			node_type* position = _root; // Where the node will be inserted.
-			// If tree is empty.
-			if (_size == 0) {
-				_root = new_node;
-				_root->left_child = _nil;
-				_root->right_child = _nil;
-				_root->parent = _nil;
-				_root->color = BLACK;
-				_nil->parent = _root;
-				_size++;
-				return ft::make_pair(_root, true);
-			}
-			// Check if the hint position is valid.
-			if (hint != ft_nullptr && hint->value != ft_nullptr)
-				position = check_hint(val, hint);
-			// Find the position where the node will be inserted.
-			ft::pair<node_type*, bool> is_valid = get_position(position, new_node);
-			if (is_valid.second == false) {
-				_node_alloc.destroy(new_node);
-				_node_alloc.deallocate(new_node, 1);
+			bool insert_left = false;
+			// Find the parent of the new node first, so that an existing key never allocates.
+			ft::pair<node_type*, bool> is_valid = (hint != ft_nullptr)
+				? get_hint_position(hint, get_key(val), insert_left)
+				: get_position(get_key(val), insert_left);
+			if (is_valid.second == false)
 				return is_valid;
+			return ft::make_pair(insert_node(is_valid.first, val, insert_left), true);
+		}
+
+		// An empty tree is built bottom-up in O(n) when the range is sorted and unique,
+		// which sorted promises or is checked on the way. Otherwise its nodes are merge sorted
+		// and the duplicates dropped first. A non-empty tree inserts the elements one by one.
+		template <typename InputIterator>
+		void insert_range(InputIterator first, InputIterator last, bool sorted = false) {
+			if (_size != 0) {
+				while (first != last)
+					insert(*first++);
+				return;
 			}
-			// A new_node has been inserted,
-			// and now we need to balance it according to the rules of the RBTree.
-			insert_case1(new_node);
-			_size++;
-			_nil->parent = get_max_value_node();
-			return ft::make_pair(new_node, true);
+			if (first == last)
+				return;
+			// Collect the nodes in input order, linked through parent.
+			node_type* list = ft_nullptr;
+			node_type* tail = ft_nullptr;
+			size_type n = 0;
+			bool in_order = true;
+			try {
+				while (first != last) {
+					node_type* node = make_node(*first++);
+					node->parent = ft_nullptr;
+					if (tail == ft_nullptr)
+						list = node;
+					else {
+						if (!sorted && in_order && !_comp(get_key(tail->value), get_key(node->value)))
+							in_order = false;
+						tail->parent = node;
+					}
+					tail = node;
+					n++;
+				}
+			}
+			catch (...) {
+				destroy_list(list);
+				throw;
+			}
+			if (!in_order) {
+				list = sort_list(list);
+				n = unique_list(list);
+			}
+			build(list, n);
 		}
 
 		size_type erase(node_type* node) {
-			if (node->value == ft_nullptr)
+			if (node == _nil)
 				return 0;
-			// node의 왼쪽 서브트리에서 최댓값 / 오른쪽 서브트리에서 최솟값을 찾음.
-			// node와 M의 값을 바꾸고 M을 리턴받음.
-			node_type* real = replace_erase_node(node);
-			// 진짜 삭제할 노드는 M(real)이고, 그 자식 노드를 child라고 함.
-			node_type* child;
-			if (real->right_child->value == ft_nullptr)
-				child = real->left_child;
-			else
-				child = real->right_child;
-			// 1) M이 RED인 경우, 무조건 그 자식 노드들은 nil이었을 것이다(BLACK). M을 nil로 바꾸면 됨.
-			replace_node(real, child);
-			if (real->color == BLACK) {
-				// 2) M이 BLACK이고 C가 RED인 경우, M을 C로 바꾸고 색을 BLACK으로 바꾼다.
-				if (child->color == RED)
-					child->color = BLACK;
-				else
-					delete_case1(child);
-				// 3) M과 C가 모두 BLACK인 경우, C는 무조건 nil이었을 것이다. 
+			erase_node(node);
+			return 1;
+		}
+
+		// Unlinks node, which must be a real node of this tree, and destroys it.
+		// A node with two children is replaced by its successor, found by one walk down
+		// its right subtree. Nodes are relinked, no value is copied.
+		void erase_node(node_type* node) {
+			// The cached ends move to the in-order neighbour of node.
+			if (node == _leftmost)
+				_leftmost = (node->right_child != _nil) ? get_min_node(node->right_child) : node->parent;
+			if (node == _rightmost)
+				_rightmost = (node->left_child != _nil) ? get_max_node(node->left_child) : node->parent;
+			node_type* child;					// Takes the place of the node leaving its position, may be _nil.
+			node_type* child_parent;	// Parent of child afterwards, child may be _nil.
+			RBColor removed_color;		// Color that leaves the tree.
+			if (node->left_child == _nil || node->right_child == _nil) {
+				child = (node->left_child != _nil) ? node->left_child : node->right_child;
+				child_parent = node->parent;
+				if (child != _nil)
+					child->parent = child_parent;
+				replace_child(node, child);
+				removed_color = node->color;
 			}
+			else {
+				node_type* next = get_min_node(node->right_child);
+				child = next->right_child;
+				if (next == node->right_child)
+					child_parent = next;
+				else {
+					// next leaves its position under the right subtree first.
+					child_parent = next->parent;
+					if (child != _nil)
+						child->parent = child_parent;
+					child_parent->left_child = child;
+					next->right_child = node->right_child;
+					next->right_child->parent = next;
+				}
+				next->left_child = node->left_child;
+				next->left_child->parent = next;
+				next->parent = node->parent;
+				replace_child(node, next);
+				removed_color = next->color;
+				next->color = node->color;
+			}
+			if (removed_color == BLACK)
+				erase_fixup(child, child_parent);
+			destroy_node(node);
 			_size--;
-			if (real->parent->value == ft_nullptr)
-				_root = _nil;
-			delete real;
-			_nil->parent = get_max_value_node();
-			return 1;
+			_nil->parent = _rightmost;
 		}
 
 		void swap(SetTree& x) {
 			swap(_root, x._root);
 			swap(_nil, x._nil);
+			swap(_leftmost, x._leftmost);
+			swap(_rightmost, x._rightmost);
 			swap(_comp, x._comp);
 			swap(_size, x._size);
+			swap(_alloc, x._alloc);
 			swap(_node_alloc, x._node_alloc);
 		}
 
 		void clear(node_type* node = ft_nullptr) {
-			if (node == ft_nullptr)
+			if (node == ft_nullptr) {
+				if (_size != 0 && release_nodes()) {
+					_nil = make_nil();
+					_root = _nil;
+					_leftmost = _nil;
+					_rightmost = _nil;
+					_size = 0;
+					return;
+				}
 				node = _root;
-			if (node->left_child->value != ft_nullptr) {
+			}
+			if (node->left_child != _nil) {
 				clear(node->left_child);
 				node->left_child = _nil;
 			}
-			if (node->right_child->value != ft_nullptr) {
+			if (node->right_child != _nil) {
 				clear(node->right_child);
 				node->right_child = _nil;
 			}
 			// delete
-			if (node->value != ft_nullptr) {
-				if (node == _root)
+			if (node != _nil) {
+				if (node == _root) {
 					_root = _nil;
-				_node_alloc.destroy(node);
-				_node_alloc.deallocate(node, 1);
+					_leftmost = _nil;
+					_rightmost = _nil;
+					_nil->parent = _nil;
+				}
+				destroy_node(node);
 				_size--;
 			}
 		}
 
 		// Operations:
-		node_type* find(value_type val) const {
+		// The lookups take any key type the comparator accepts, so no value_type is built.
+		// One comparison per level: a three-way comparator stops on the key,
+		// a less-than one goes down to the lower bound and checks it once.
+		template <typename K>
+		node_type* find(const K& k) const {
+			if (!three_way_compare::value) {
+				node_type* res = lower_bound(k);
+				if (res != _nil && _comp(k, get_key(res->value)))
+					return _nil;
+				return res;
+			}
 			node_type* res = _root;
-			if (_size == 0)
-				return _nil;
-			while (res->value != ft_nullptr && (_comp(val, *res->value) || _comp(*res->value, val))) {
-				if (_comp(val, *res->value))
+			while (res != _nil) {
+				int order = three_way_compare::compare(_comp, k, get_key(res->value));
+				if (order < 0)
 					res = res->left_child;
-				else
+				else if (order > 0)
 					res = res->right_child;
+				else
+					break;
 			}
 			return res;
 		}
 
-		node_type* lower_bound(const value_type& val) const {
-			iterator it(get_begin());
-			iterator ite(get_end());
-			while (it != ite) {
-				if (!_comp(*it, val))
-					break;
-				it++;
+		template <typename K>
+		node_type* lower_bound(const K& k) const {
+			node_type* res = _nil;
+			node_type* node = _root;
+			// Descend from the root, keeping the last node that is not less than k.
+			while (node != _nil) {
+				if (!_comp(get_key(node->value), k)) {
+					res = node;
+					node = node->left_child;
+				}
+				else
+					node = node->right_child;
 			}
-			return it.base();
+			return res;
 		}
 
-		node_type* upper_bound(const value_type& val) const {
-			iterator it(get_begin());
-			iterator ite(get_end());
-			while (it != ite) {
-				if (_comp(val, *it))
+		template <typename K>
+		node_type* upper_bound(const K& k) const {
+			node_type* res = _nil;
+			node_type* node = _root;
+			// Descend from the root, keeping the last node that is greater than k.
+			while (node != _nil) {
+				if (_comp(k, get_key(node->value))) {
+					res = node;
+					node = node->left_child;
+				}
+				else
+					node = node->right_child;
+			}
+			return res;
+		}
+
+		template <typename K>
+		ft::pair<node_type*, node_type*> equal_range(const K& k) const {
+			node_type* lower = _nil;
+			node_type* upper = _nil;
+			node_type* node = _root;
+			// Both bounds share the path from the root down to the first equivalent node.
+			while (node != _nil) {
+				int order = three_way_compare::compare(_comp, k, get_key(node->value));
+				if (order < 0) {
+					lower = node;
+					upper = node;
+					node = node->left_child;
+				}
+				else if (order > 0)
+					node = node->right_child;
+				else {
+					// The lower bound is left of node, the upper bound is right of it.
+					node_type* tmp = node->right_child;
+					while (tmp != _nil) {
+						if (_comp(k, get_key(tmp->value))) {
+							upper = tmp;
+							tmp = tmp->left_child;
+						}
+						else
+							tmp = tmp->right_child;
+					}
+					lower = node;
+					tmp = node->left_child;
+					while (tmp != _nil) {
+						if (!_comp(get_key(tmp->value), k)) {
+							lower = tmp;
+							tmp = tmp->left_child;
+						}
+						else
+							tmp = tmp->right_child;
+					}
 					break;
-				it++;
+				}
 			}
-			return it.base();
+			return ft::make_pair(lower, upper);
 		}
 
 	private :
@@ -236,85 +374,357 @@ namespace ft
 				return grand->left_child;
 		}
 
-		node_type* get_sibling(node_type* node) const {
-			if (node == node->parent->left_child)
-				return node->parent->right_child;
-			else
-				return node->parent->left_child;
+		node_type* get_min_node(node_type* node) const {
+			while (node->left_child != _nil)
+				node = node->left_child;
+			return node;
+		}
+
+		node_type* get_max_node(node_type* node) const {
+			while (node->right_child != _nil)
+				node = node->right_child;
+			return node;
+		}
+
+		// In-order neighbours of a node that has one.
+		node_type* get_prev_node(node_type* node) const {
+			if (node->left_child != _nil)
+				return get_max_node(node->left_child);
+			while (node == node->parent->left_child)
+				node = node->parent;
+			return node->parent;
 		}
 
-		node_type* get_max_value_node() const {
-			node_type* tmp = _root;
-			while (tmp->right_child->value != ft_nullptr)
-				tmp = tmp->right_child;
-			return tmp;
+		node_type* get_next_node(node_type* node) const {
+			if (node->right_child != _nil)
+				return get_min_node(node->right_child);
+			while (node == node->parent->right_child)
+				node = node->parent;
+			return node->parent;
 		}
 
+		static const key_type& get_key(const value_type& val) { return KeyOfValue()(val); }
+
+		// The nil node only holds links, its value is never constructed.
 		node_type* make_nil() {
 			node_type* res = _node_alloc.allocate(1);
-			_node_alloc.construct(res, node_type());
 			res->color = BLACK;
 			res->left_child = res;
 			res->right_child = res;
 			res->parent = res;
-			res->value = ft_nullptr;
 			return res;
 		}
 
-		node_type* make_node(const value_type& val) {
-			node_type* res = _node_alloc.allocate(1);
-			_node_alloc.construct(res, node_type(val));
+		// A node and its value share a single allocation.
+		node_type* make_node(const value_type& val) { return construct_node(_node_alloc.allocate(1), val); }
+
+		// Constructs val in the raw node res, res is released if the copy throws.
+		node_type* construct_node(node_type* res, const value_type& val) {
+			try {
+				_alloc.construct(&res->value, val);
+			}
+			catch (...) {
+				_node_alloc.deallocate(res, 1);
+				throw;
+			}
+			res->left_child = _nil;
+			res->right_child = _nil;
+			res->parent = _nil;
+			res->color = RED;
 			return res;
 		}
 
-		node_type* check_hint(value_type val, node_type* hint) {
-			if (_comp(*hint->value, *_root->value) && _comp(val, *hint->value))
-				return hint;
-			else if (_comp(*hint->value, *_root->value) && _comp(*hint->value, val))
-				return _root;
-			else if (_comp(*_root->value, *hint->value) && _comp(val, *hint->value))
-				return _root;
-			else if (_comp(*_root->value, *hint->value) && _comp(*hint->value, val))
-				return hint;
+		void destroy_node(node_type* node) {
+			_alloc.destroy(&node->value);
+			_node_alloc.deallocate(node, 1);
+		}
+
+		// Frees every node, _nil included, in one go when the values need no destructor
+		// and the node allocator can drop all its memory at once (ft::pool_allocator).
+		bool release_nodes() {
+			if (!ft::has_trivial_destructor<value_type>::value)
+				return false;
+			return ft::release_all<node_allocator_type>::release(_node_alloc);
+		}
+
+		// Empties the tree and returns its nodes as a list linked through parent.
+		// The tree is flattened with right rotations, so no stack is needed.
+		node_type* detach_nodes() {
+			node_type* list = ft_nullptr;
+			node_type* node = _root;
+			while (node != _nil) {
+				if (node->left_child != _nil) {
+					node_type* left = node->left_child;
+					node->left_child = left->right_child;
+					left->right_child = node;
+					node = left;
+				}
+				else {
+					node_type* next = node->right_child;
+					node->parent = list;
+					list = node;
+					node = next;
+				}
+			}
+			_root = _nil;
+			_leftmost = _nil;
+			_rightmost = _nil;
+			_nil->parent = _nil;
+			_size = 0;
+			return list;
+		}
+
+		void destroy_list(node_type* list) {
+			while (list != ft_nullptr) {
+				node_type* next = list->parent;
+				destroy_node(list);
+				list = next;
+			}
+		}
+
+		// Copies the value and the color of src into a node taken from reuse, or a new one.
+		node_type* clone_node(const node_type* src, node_type*& reuse) {
+			node_type* res;
+			if (reuse != ft_nullptr) {
+				res = reuse;
+				reuse = reuse->parent;
+				_alloc.destroy(&res->value);
+				construct_node(res, src->value);
+			}
 			else
-				return _root;
-		}
-
-		ft::pair<node_type*, bool> get_position(node_type* position, node_type* node) {
-			while (position->value != ft_nullptr) {
-				if (_comp(*node->value, *position->value)) {
-					if (position->left_child->value == ft_nullptr) {
-						position->left_child = node;
-						node->parent = position;
-						node->left_child = _nil;
-						node->right_child = _nil;
-						node->color = RED;
-						break;
+				res = make_node(src->value);
+			res->color = src->color;
+			_size++;
+			return res;
+		}
+
+		// Bottom-up merge sort of a list linked through parent, returns the new head.
+		// Equivalent keys keep their input order, so unique_list keeps the first one.
+		node_type* sort_list(node_type* list) const {
+			for (size_type width = 1; ; width *= 2) {
+				node_type* p = list;
+				node_type* tail = ft_nullptr;
+				size_type merges = 0;
+				while (p != ft_nullptr) {
+					// Merge the run of width nodes starting at p with the one following it.
+					node_type* q = p;
+					size_type p_size = 0;
+					size_type q_size = width;
+					while (p_size < width && q != ft_nullptr) {
+						q = q->parent;
+						p_size++;
 					}
-					else
-						position = position->left_child;
-				}
-				else if (_comp(*position->value, *node->value)) {
-					if (position->right_child->value == ft_nullptr) {
-						position->right_child = node;
-						node->parent = position;
-						node->left_child = _nil;
-						node->right_child = _nil;
-						node->color = RED;
-						break;
+					while (p_size > 0 || (q_size > 0 && q != ft_nullptr)) {
+						node_type* node;
+						if (p_size == 0 || (q_size > 0 && q != ft_nullptr && _comp(get_key(q->value), get_key(p->value)))) {
+							node = q;
+							q = q->parent;
+							q_size--;
+						}
+						else {
+							node = p;
+							p = p->parent;
+							p_size--;
+						}
+						if (tail == ft_nullptr)
+							list = node;
+						else
+							tail->parent = node;
+						tail = node;
 					}
-					else
-						position = position->right_child;
+					p = q;
+					merges++;
+				}
+				tail->parent = ft_nullptr;
+				if (merges <= 1)
+					return list;
+			}
+		}
+
+		// Destroys the nodes equivalent to their predecessor in a sorted list, returns its new length.
+		size_type unique_list(node_type* list) {
+			size_type n = 1;
+			while (list->parent != ft_nullptr) {
+				node_type* next = list->parent;
+				if (!_comp(get_key(list->value), get_key(next->value))) {
+					list->parent = next->parent;
+					destroy_node(next);
+				}
+				else {
+					list = next;
+					n++;
+				}
+			}
+			return n;
+		}
+
+		// Links a sorted list of n unique nodes into the empty tree. The nil leaves all sit at depth
+		// floor(log2(n + 1)) or one below it, so the nodes on that last full level are colored red
+		// (unless the tree is perfect) and every path holds the same number of black nodes.
+		void build(node_type* list, size_type n) {
+			size_type red_depth = 0;
+			while ((static_cast<size_type>(2) << red_depth) - 1 <= n)
+				red_depth++;
+			if (((n + 1) & n) == 0)
+				red_depth = n;	// Perfect tree, no red node.
+			_leftmost = list;
+			_root = build_subtree(list, n, 0, red_depth);
+			_root->parent = _nil;
+			_size = n;
+			_nil->parent = _rightmost;
+		}
+
+		node_type* build_subtree(node_type*& list, size_type n, size_type depth, size_type red_depth) {
+			if (n == 0)
+				return _nil;
+			size_type left_size = (n - 1) / 2;
+			node_type* left = build_subtree(list, left_size, depth + 1, red_depth);
+			node_type* node = list;
+			list = list->parent;
+			node->color = (depth == red_depth) ? RED : BLACK;
+			node->left_child = left;
+			if (left != _nil)
+				left->parent = node;
+			_rightmost = node;
+			node->right_child = build_subtree(list, n - 1 - left_size, depth + 1, red_depth);
+			if (node->right_child != _nil)
+				node->right_child->parent = node;
+			return node;
+		}
+
+		// Pre-order walk of x that follows the parent links back up instead of recursing.
+		// A child is cloned the first time its slot in the copy is still _nil.
+		void clone(const SetTree& x, node_type*& reuse) {
+			const node_type* src = x._root;
+			node_type* dst = clone_node(src, reuse);
+			_root = dst;
+			while (true) {
+				if (src->left_child != x._nil && dst->left_child == _nil) {
+					dst->left_child = clone_node(src->left_child, reuse);
+					dst->left_child->parent = dst;
+					src = src->left_child;
+					dst = dst->left_child;
+				}
+				else if (src->right_child != x._nil && dst->right_child == _nil) {
+					dst->right_child = clone_node(src->right_child, reuse);
+					dst->right_child->parent = dst;
+					src = src->right_child;
+					dst = dst->right_child;
+				}
+				else if (src != x._root) {
+					src = src->parent;
+					dst = dst->parent;
 				}
 				else
-					return ft::make_pair(position, false);
+					break;
+			}
+			_leftmost = get_min_node(_root);
+			_rightmost = get_max_node(_root);
+			_nil->parent = _rightmost;
+		}
+
+		// get_position for a new node placed right before hint (end() included).
+		// A right hint links the node next to hint or its in-order neighbour in O(1),
+		// otherwise the search falls back to a descent from the root.
+		ft::pair<node_type*, bool> get_hint_position(node_type* hint, const key_type& k, bool& insert_left) const {
+			if (hint == _nil) {
+				// Appending after the current maximum.
+				if (_size != 0 && _comp(get_key(_rightmost->value), k)) {
+					insert_left = false;
+					return ft::make_pair(_rightmost, true);
+				}
 			}
-			return ft::make_pair(position, true);
+			else if (_comp(k, get_key(hint->value))) {
+				if (hint == _leftmost) {
+					insert_left = true;
+					return ft::make_pair(hint, true);
+				}
+				node_type* before = get_prev_node(hint);
+				if (_comp(get_key(before->value), k)) {
+					// Either before has no right child or hint has no left child.
+					insert_left = (before->right_child != _nil);
+					return ft::make_pair(insert_left ? hint : before, true);
+				}
+			}
+			else if (_comp(get_key(hint->value), k)) {
+				if (hint == _rightmost) {
+					insert_left = false;
+					return ft::make_pair(hint, true);
+				}
+				node_type* after = get_next_node(hint);
+				if (_comp(k, get_key(after->value))) {
+					// Either hint has no right child or after has no left child.
+					insert_left = (hint->right_child != _nil);
+					return ft::make_pair(insert_left ? after : hint, true);
+				}
+			}
+			else
+				return ft::make_pair(hint, false);
+			return get_position(k, insert_left);
+		}
+
+		// Returns the parent of the new node and true, or the node already holding k and false.
+		// Like find, it makes one comparison per level. Without a three-way comparator the
+		// equivalent key can only be the in-order predecessor of the new position, checked last.
+		ft::pair<node_type*, bool> get_position(const key_type& k, bool& insert_left) const {
+			node_type* parent = _nil;
+			node_type* node = _root;
+			insert_left = true;
+			while (node != _nil) {
+				parent = node;
+				if (three_way_compare::value) {
+					int order = three_way_compare::compare(_comp, k, get_key(node->value));
+					if (order == 0)
+						return ft::make_pair(node, false);
+					insert_left = (order < 0);
+				}
+				else
+					insert_left = _comp(k, get_key(node->value));
+				node = insert_left ? node->left_child : node->right_child;
+			}
+			if (three_way_compare::value || parent == _nil)
+				return ft::make_pair(parent, true);
+			node_type* before = parent;
+			if (insert_left) {
+				if (parent == _leftmost)
+					return ft::make_pair(parent, true);
+				before = get_prev_node(parent);
+			}
+			if (_comp(get_key(before->value), k))
+				return ft::make_pair(parent, true);
+			return ft::make_pair(before, false);
+		}
+
+		// Constructs the only node of the insertion and links it under parent.
+		node_type* insert_node(node_type* parent, const value_type& val, bool insert_left) {
+			node_type* new_node = make_node(val);
+			new_node->parent = parent;
+			if (parent == _nil) {
+				_root = new_node;
+				_leftmost = new_node;
+				_rightmost = new_node;
+			}
+			else if (insert_left) {
+				parent->left_child = new_node;
+				if (parent == _leftmost)
+					_leftmost = new_node;
+			}
+			else {
+				parent->right_child = new_node;
+				if (parent == _rightmost)
+					_rightmost = new_node;
+			}
+			// A new_node has been inserted,
+			// and now we need to balance it according to the rules of the RBTree.
+			insert_case1(new_node);
+			_size++;
+			_nil->parent = _rightmost;
+			return new_node;
 		}
 
 		void insert_case1(node_type* node) {
 			// new_node is not root node
-			if (node->parent->value != ft_nullptr)
+			if (node->parent != _nil)
 				insert_case2(node);
 			else
 				node->color = BLACK;
@@ -330,7 +740,7 @@ namespace ft
 			// If new_node's parent and uncle is all RED,
 			node_type* uncle = get_uncle(node);
 			node_type* grand;
-			if (uncle->value != ft_nullptr && uncle->color == RED) {
+			if (uncle != _nil && uncle->color == RED) {
 				node->parent->color = BLACK;
 				uncle->color = BLACK;
 				grand = get_grandparent(node);
@@ -369,13 +779,13 @@ namespace ft
 		void rotate_left(node_type* node) {
 			node_type* child = node->right_child;
 			node_type* parent = node->parent;
-			if (child->left_child->value != ft_nullptr)
+			if (child->left_child != _nil)
 				child->left_child->parent = node;
 			node->right_child = child->left_child;
 			node->parent = child;
 			child->left_child = node;
 			child->parent = parent;
-			if (parent->value != ft_nullptr) {
+			if (parent != _nil) {
 				if (parent->left_child == node)
 					parent->left_child = child;
 				else
@@ -388,13 +798,13 @@ namespace ft
 		void rotate_right(node_type* node) {
 			node_type* child = node->left_child;
 			node_type* parent = node->parent;
-			if (child->right_child->value != ft_nullptr)
+			if (child->right_child != _nil)
 				child->right_child->parent = node;
 			node->left_child = child->right_child;
 			node->parent = child;
 			child->right_child = node;
 			child->parent = parent;
-			if (parent->value != ft_nullptr) {
+			if (parent != _nil) {
 				if (parent->right_child == node)
 					parent->right_child = child;
 				else
@@ -404,161 +814,74 @@ namespace ft
 				_root = child;
 		}
 
-		node_type* replace_erase_node(node_type* node) {
-			// node의 left_child가 있으면, 왼쪽 서브트리에서 최댓값,
-			// node의 left_child가 없으면, 오른쪽 서브트리에서 최솟값을 찾는다.
-			// 찾은 값의 value를 node에 복사하고, 찾은 그 노드는 삭제해야 하므로 리턴한다.
-			node_type* result;
-			if (node->left_child->value != ft_nullptr) {
-				result = node->left_child;
-				while (result->right_child->value != ft_nullptr)
-					result = result->right_child;
-			}
-			else if (node->right_child->value != ft_nullptr) {
-				result = node->right_child;
-				while (result->left_child->value != ft_nullptr)
-					result = result->left_child;
-			}
-			else
-				return node;
-
-			node_type* tmp_parent = node->parent;
-			node_type* tmp_left = node->left_child;
-			node_type* tmp_right = node->right_child;
-			RBColor tmp_color = node->color;
-
-			// node의 left/right_child 설정
-			node->left_child = result->left_child;
-			if (result->left_child->value != ft_nullptr)
-				result->left_child->parent = node;
-			node->right_child = result->right_child; 
-			if (result->right_child->value != ft_nullptr)
-				result->right_child->parent = node;
-
-			// result를 node->parent의 left/right_child로 설정
-			if (tmp_parent->left_child == node)
-				tmp_parent->left_child = result;
-			else if (tmp_parent->right_child == node)
-				tmp_parent->right_child = result;
-
-			if (result == tmp_left) {
-				// result의 형제를 result의 left/right_child로 연결
-				tmp_right->parent = result;
-				result->right_child = tmp_right;
-				// node를 result의 left/right_child로 연결
-				node->parent = result;
-				result->left_child = node;
-			}
-			else if (result == tmp_right) {
-				tmp_left->parent = result;
-				result->left_child = tmp_left;
-				node->parent = result;
-				result->right_child = node;
-			}
-			else {
-				// result와 node가 멀리 떨어진 경우
-				tmp_left->parent = result;
-				result->left_child = tmp_left;
-				tmp_right->parent = result;
-				result->right_child = tmp_right;
-				node->parent = result->parent;
-				result->parent->right_child = node;
-			}
-
-			// result의 parent 연결
-			result->parent = tmp_parent;
-
-			if (result->parent->value == ft_nullptr)
-				_root = result;
-			node->color = result->color;
-			result->color = tmp_color;
-
-			return node;
-		}
-
-		void replace_node(node_type* node, node_type* child) {
-			// The case where the parent of node becomes ft_nullptr
-			// can be handled in advance so that it does not come into delete_case.
-			child->parent = node->parent;
-			if (node->parent->left_child == node)
+		// Links child where node was under node->parent, or as the root.
+		void replace_child(node_type* node, node_type* child) {
+			if (node->parent == _nil)
+				_root = child;
+			else if (node->parent->left_child == node)
 				node->parent->left_child = child;
-			else// if (node->parent->right_child == node)
-				node->parent->right_child = child;
-		}
-
-		void delete_case1(node_type* node) {
-			if (node->parent->value != ft_nullptr)
-				delete_case2(node);
-		}
-
-		void delete_case2(node_type* node) {
-			node_type* sibling = get_sibling(node);
-			if (sibling->color == RED) {
-				node->parent->color = RED;
-				sibling->color = BLACK;
-				if (node == node->parent->left_child)
-					rotate_left(node->parent);
-				else
-					rotate_right(node->parent);
-			}
-			delete_case3(node);
-		}
-
-		void delete_case3(node_type* node) {
-			node_type* sibling = get_sibling(node);
-			if (node->parent->color == BLACK && sibling->color == BLACK &&
-					sibling->left_child->color == BLACK && sibling->right_child->color == BLACK) {
-				sibling->color = RED;
-				delete_case1(node->parent);
-			}
 			else
-				delete_case4(node);
-		}
-
-		void delete_case4(node_type* node) {
-			node_type* sibling = get_sibling(node);
-			if (node->parent->color == RED && sibling->color == BLACK &&
-					sibling->left_child->color == BLACK && sibling->right_child->color == BLACK) {
-				sibling->color = RED;
-				node->parent->color = BLACK;
-			}
-			else
-				delete_case5(node);
+				node->parent->right_child = child;
 		}
 
-		void delete_case5(node_type* node) {
-			node_type* sibling = get_sibling(node);
-			node_type* tmp = node->parent;
-			if (sibling->color == BLACK) {
-				if (node == node->parent->left_child &&
-						sibling->right_child->color == BLACK && sibling->left_child->color == RED) {
-					sibling->color = RED;
-					sibling->left_child->color = BLACK;
-					rotate_right(sibling);
-				}
-				else if (node == node->parent->right_child &&
-								sibling->left_child->color == BLACK && sibling->right_child->color == RED) {
-					sibling->color = RED;
+		// A black node left the path to node, which may be _nil, so node carries an extra black.
+		// The extra black is moved up until it lands on a red node or the root,
+		// or it is resolved with at most three rotations.
+		void erase_fixup(node_type* node, node_type* parent) {
+			while (node != _root && node->color == BLACK) {
+				if (node == parent->left_child) {
+					node_type* sibling = parent->right_child;
+					if (sibling->color == RED) {
+						sibling->color = BLACK;
+						parent->color = RED;
+						rotate_left(parent);
+						sibling = parent->right_child;
+					}
+					if (sibling->left_child->color == BLACK && sibling->right_child->color == BLACK) {
+						sibling->color = RED;
+						node = parent;
+						parent = parent->parent;
+						continue;
+					}
+					if (sibling->right_child->color == BLACK) {
+						sibling->left_child->color = BLACK;
+						sibling->color = RED;
+						rotate_right(sibling);
+						sibling = parent->right_child;
+					}
+					sibling->color = parent->color;
+					parent->color = BLACK;
 					sibling->right_child->color = BLACK;
-					rotate_left(sibling);
+					rotate_left(parent);
 				}
+				else {
+					node_type* sibling = parent->left_child;
+					if (sibling->color == RED) {
+						sibling->color = BLACK;
+						parent->color = RED;
+						rotate_right(parent);
+						sibling = parent->left_child;
+					}
+					if (sibling->left_child->color == BLACK && sibling->right_child->color == BLACK) {
+						sibling->color = RED;
+						node = parent;
+						parent = parent->parent;
+						continue;
+					}
+					if (sibling->left_child->color == BLACK) {
+						sibling->right_child->color = BLACK;
+						sibling->color = RED;
+						rotate_left(sibling);
+						sibling = parent->left_child;
+					}
+					sibling->color = parent->color;
+					parent->color = BLACK;
+					sibling->left_child->color = BLACK;
+					rotate_right(parent);
+				}
+				break;
 			}
-			node->parent = tmp;
-			delete_case6(node);
-		}
-
-		void delete_case6(node_type* node) {
-			node_type* sibling = get_sibling(node);
-			sibling->color = node->parent->color;
-			node->parent->color = BLACK;
-			if (node == node->parent->left_child) {
-				sibling->right_child->color = BLACK;
-				rotate_left(node->parent);
-			}
-			else {
-				sibling->left_child->color = BLACK;
-				rotate_right(node->parent);
-			}
+			node->color = BLACK;
 		}
 
 		template <typename _T>
@@ -573,8 +896,11 @@ namespace ft
 		 */
 		node_type*					_root;
 		node_type*					_nil;
+		node_type*					_leftmost;	// begin()
+		node_type*					_rightmost;	// _nil->parent, the node before end()
 		size_type						_size;
-		value_comp					_comp;
+		key_compare					_comp;
+		allocator_type			_alloc;
 		node_allocator_type	_node_alloc;
 	};
 } // namespace ft
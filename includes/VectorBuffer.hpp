@@ -0,0 +1,184 @@
+#ifndef VECTORBUFFER_HPP
+#define VECTORBUFFER_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include "utils.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief detail
+	 * Element moves inside and between contiguous buffers, shared by vector and small_vector.
+	 * Every function builds or destroys through the allocator it is given.
+	 */
+	namespace detail
+	{
+		template <class Alloc>
+		void destroy_range(Alloc& alloc, typename Alloc::pointer first, typename Alloc::pointer last) {
+			while (first != last)
+				alloc.destroy(first++);
+		}
+
+		// Copy constructs [first, last) from dest on, what was built is destroyed if a copy throws.
+		template <class Alloc, class InputIterator>
+		typename Alloc::pointer construct_range(Alloc& alloc, InputIterator first, InputIterator last, typename Alloc::pointer dest) {
+			typename Alloc::pointer cur = dest;
+			try {
+				for (; first != last; ++first, ++cur)
+					alloc.construct(cur, *first);
+			}
+			catch (...) {
+				detail::destroy_range(alloc, dest, cur);
+				throw;
+			}
+			return cur;
+		}
+
+		template <class Alloc>
+		typename Alloc::pointer construct_fill(Alloc& alloc, typename Alloc::pointer dest, typename Alloc::size_type n,
+																						const typename Alloc::value_type& val) {
+			if (ft::is_trivially_copyable<typename Alloc::value_type>::value)
+				return ft::fill_trivial(dest, n, val);
+			typename Alloc::pointer cur = dest;
+			try {
+				for (; n > 0; --n, ++cur)
+					alloc.construct(cur, val);
+			}
+			catch (...) {
+				detail::destroy_range(alloc, dest, cur);
+				throw;
+			}
+			return cur;
+		}
+
+		// Destroys [dest, dest_last) built by transfer_range, swapping the contents back to src first.
+		template <class Alloc>
+		void undo_transfer(Alloc& alloc, typename Alloc::pointer dest, typename Alloc::pointer dest_last, typename Alloc::pointer src) {
+			if (ft::is_swap_relocatable<typename Alloc::value_type>::value) {
+				using std::swap;
+				for (typename Alloc::pointer cur = dest; cur != dest_last; ++cur, ++src)
+					swap(*cur, *src);
+			}
+			detail::destroy_range(alloc, dest, dest_last);
+		}
+
+		template <class Alloc>
+		typename Alloc::pointer transfer_range(Alloc& alloc, typename Alloc::pointer first, typename Alloc::pointer last,
+																						typename Alloc::pointer dest, ft::false_type) {
+			return detail::construct_range(alloc, first, last, dest);
+		}
+
+		template <class Alloc>
+		typename Alloc::pointer transfer_range(Alloc& alloc, typename Alloc::pointer first, typename Alloc::pointer last,
+																						typename Alloc::pointer dest, ft::true_type) {
+			typename Alloc::pointer cur = dest;
+			try {
+				for (; first != last; ++first, ++cur) {
+					::new (static_cast<void*>(cur)) typename Alloc::value_type();
+					using std::swap;
+					swap(*cur, *first);
+				}
+			}
+			catch (...) {
+				detail::undo_transfer(alloc, dest, cur, first - (cur - dest));
+				throw;
+			}
+			return cur;
+		}
+
+		// Moves [first, last) to raw storage at dest for a reallocation. Swap-relocatable elements
+		// are default constructed and swapped, leaving the sources empty, the others are copied.
+		// If an element fails, the ones already moved are given back and destroyed.
+		template <class Alloc>
+		typename Alloc::pointer transfer_range(Alloc& alloc, typename Alloc::pointer first, typename Alloc::pointer last,
+																						typename Alloc::pointer dest) {
+			typedef typename ft::choose<ft::is_swap_relocatable<typename Alloc::value_type>::value, ft::true_type, ft::false_type>::type swappable;
+			return detail::transfer_range(alloc, first, last, dest, swappable());
+		}
+
+		// Shifts of live elements over live slots, [first, last) to dest (left) or to end at dest_last (right).
+		// Swap-relocatable elements are swapped, so no heap block is copied, the others are assigned.
+		template <class T>
+		T* shift_left(T* first, T* last, T* dest) {
+			if (!ft::is_swap_relocatable<T>::value)
+				return std::copy(first, last, dest);
+			using std::swap;
+			for (; first != last; ++first, ++dest)
+				swap(*dest, *first);
+			return dest;
+		}
+
+		template <class T>
+		void shift_right(T* first, T* last, T* dest_last) {
+			if (!ft::is_swap_relocatable<T>::value) {
+				std::copy_backward(first, last, dest_last);
+				return;
+			}
+			using std::swap;
+			while (first != last)
+				swap(*--dest_last, *--last);
+		}
+
+		// Bytewise moves of relocatable elements, the source is left as raw storage.
+		template <class T>
+		T* relocate_range(T* first, T* last, T* dest) {
+			if (first != last)
+				std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(T));
+			return dest + (last - first);
+		}
+
+		// Shifts [position, finish) n slots right, leaving raw storage at position. Returns the new finish.
+		template <class T>
+		T* open_gap(T* position, T* finish, size_t n) {
+			if (position != finish)
+				std::memmove(static_cast<void*>(position + n), static_cast<const void*>(position), (finish - position) * sizeof(T));
+			return finish + n;
+		}
+
+		// Shifts [position + n, finish) n slots left over raw storage at position. Returns the new finish.
+		template <class T>
+		T* close_gap(T* position, T* finish, size_t n) {
+			if (position + n != finish)
+				std::memmove(static_cast<void*>(position), static_cast<const void*>(position + n), (finish - position - n) * sizeof(T));
+			return finish - n;
+		}
+
+		// Moves [first, position) before gap and [position, last) after the n elements already built at gap,
+		// in the buffer of new_cap elements at start, and returns its new finish. The old buffer is left
+		// to the caller. If a copy throws, the new buffer is destroyed and deallocated, the old one is intact.
+		// Relocatable elements are moved with memcpy, which cannot fail.
+		template <class Alloc>
+		typename Alloc::pointer relocate_around(Alloc& alloc, typename Alloc::pointer first, typename Alloc::pointer position,
+																						typename Alloc::pointer last, typename Alloc::pointer start,
+																						typename Alloc::size_type new_cap, typename Alloc::pointer gap, typename Alloc::size_type n) {
+			if (ft::is_relocatable<typename Alloc::value_type>::value) {
+				detail::relocate_range(first, position, start);
+				return detail::relocate_range(position, last, gap + n);
+			}
+			typename Alloc::pointer finish;
+			try {
+				detail::transfer_range(alloc, first, position, start);
+			}
+			catch (...) {
+				detail::destroy_range(alloc, gap, gap + n);
+				alloc.deallocate(start, new_cap);
+				throw;
+			}
+			try {
+				finish = detail::transfer_range(alloc, position, last, gap + n);
+			}
+			catch (...) {
+				detail::undo_transfer(alloc, start, gap, first);
+				detail::destroy_range(alloc, gap, gap + n);
+				alloc.deallocate(start, new_cap);
+				throw;
+			}
+			detail::destroy_range(alloc, first, last);
+			return finish;
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,406 @@
+#ifndef ALGORITHM_HPP
+#define ALGORITHM_HPP
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include "utils.hpp"
+#include "VectorIterator.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief detail
+	 * Building blocks of the algorithms below, not part of the interface.
+	 */
+	namespace detail
+	{
+		/**
+		 * @brief sort_threshold
+		 * Ranges of at most this many elements are finished by insertion sort.
+		 */
+		enum { sort_threshold = 16 };
+
+		/**
+		 * @brief swap_elements / insertion_sort
+		 * Swaps two elements through ADL, so ft containers use their own swap.
+		 * Insertion sort keeps equal elements in order. Swap-relocatable elements (strings, ft containers)
+		 * sink by swaps, the others are held in a copy while the greater ones shift up by assignment.
+		 */
+		template <typename RandomAccessIterator>
+		inline void swap_elements(RandomAccessIterator a, RandomAccessIterator b) {
+			using std::swap;
+			swap(*a, *b);
+		}
+
+		template <typename RandomAccessIterator, typename Compare>
+		void insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp, ft::false_type) {
+			typedef typename ft::iterator_traits<RandomAccessIterator>::value_type	value_type;
+			if (first == last)
+				return;
+			for (RandomAccessIterator it = first + 1; it != last; ++it) {
+				if (!comp(*it, *(it - 1)))
+					continue;
+				value_type val = *it;
+				RandomAccessIterator hole = it;
+				do {
+					*hole = *(hole - 1);
+					--hole;
+				} while (hole != first && comp(val, *(hole - 1)));
+				*hole = val;
+			}
+		}
+
+		template <typename RandomAccessIterator, typename Compare>
+		void insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp, ft::true_type) {
+			if (first == last)
+				return;
+			for (RandomAccessIterator it = first + 1; it != last; ++it) {
+				for (RandomAccessIterator cur = it; cur != first && comp(*cur, *(cur - 1)); --cur)
+					detail::swap_elements(cur, cur - 1);
+			}
+		}
+
+		template <typename RandomAccessIterator, typename Compare>
+		void insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
+			typedef typename ft::iterator_traits<RandomAccessIterator>::value_type	value_type;
+			typedef typename ft::choose<ft::is_swap_relocatable<value_type>::value, ft::true_type, ft::false_type>::type	swappable;
+			detail::insertion_sort(first, last, comp, swappable());
+		}
+
+		/**
+		 * @brief sift_down / make_heap / sort_heap
+		 * Max-heap on [first, first + len) ordered by comp, the heapsort behind partial_sort
+		 * and the fallback of sort and nth_element when partitions keep coming out unbalanced.
+		 */
+		template <typename RandomAccessIterator, typename Distance, typename Compare>
+		void sift_down(RandomAccessIterator first, Distance hole, Distance len, Compare comp) {
+			for (Distance child = 2 * hole + 1; child < len; child = 2 * hole + 1) {
+				if (child + 1 < len && comp(*(first + child), *(first + child + 1)))
+					++child;
+				if (!comp(*(first + hole), *(first + child)))
+					return;
+				detail::swap_elements(first + hole, first + child);
+				hole = child;
+			}
+		}
+
+		template <typename RandomAccessIterator, typename Compare>
+		void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
+			typedef typename ft::iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+			difference_type len = last - first;
+			for (difference_type parent = len / 2; parent > 0; )
+				detail::sift_down(first, --parent, len, comp);
+		}
+
+		template <typename RandomAccessIterator, typename Compare>
+		void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
+			typedef typename ft::iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+			for (difference_type len = last - first; len > 1; ) {
+				--len;
+				detail::swap_elements(first, first + len);
+				detail::sift_down(first, difference_type(0), len, comp);
+			}
+		}
+
+		/**
+		 * @brief partition_pivot
+		 * Moves the median of the first, middle and last elements to first and partitions [first + 1, last)
+		 * around it without copying it. Returns the first element of the right part, which is not less than the pivot.
+		 * Both scans stop on elements equal to the pivot, so many duplicates still split in the middle.
+		 */
+		template <typename RandomAccessIterator, typename Compare>
+		RandomAccessIterator partition_pivot(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
+			RandomAccessIterator a = first + 1;
+			RandomAccessIterator b = first + (last - first) / 2;
+			RandomAccessIterator c = last - 1;
+			if (comp(*a, *b)) {
+				if (comp(*b, *c))
+					detail::swap_elements(first, b);
+				else if (comp(*a, *c))
+					detail::swap_elements(first, c);
+				else
+					detail::swap_elements(first, a);
+			}
+			else if (comp(*a, *c))
+				detail::swap_elements(first, a);
+			else if (comp(*b, *c))
+				detail::swap_elements(first, c);
+			else
+				detail::swap_elements(first, b);
+
+			// The median of three bounds both scans, so they need no range check.
+			RandomAccessIterator left = first + 1;
+			RandomAccessIterator right = last;
+			while (true) {
+				while (comp(*left, *first))
+					++left;
+				--right;
+				while (comp(*first, *right))
+					--right;
+				if (!(left < right))
+					return left;
+				detail::swap_elements(left, right);
+				++left;
+			}
+		}
+
+		template <typename Size>
+		Size sort_depth_limit(Size n) {
+			Size depth = 0;
+			for (; n > 1; n >>= 1)
+				++depth;
+			return depth * 2;
+		}
+
+		template <typename RandomAccessIterator, typename Size, typename Compare>
+		void introsort_loop(RandomAccessIterator first, RandomAccessIterator last, Size depth, Compare comp) {
+			while (last - first > sort_threshold) {
+				if (depth == 0) {
+					detail::make_heap(first, last, comp);
+					detail::sort_heap(first, last, comp);
+					return;
+				}
+				--depth;
+				RandomAccessIterator cut = detail::partition_pivot(first, last, comp);
+				detail::introsort_loop(cut, last, depth, comp);
+				last = cut;
+			}
+		}
+
+		/**
+		 * @brief merge_sort_buffered / merge_without_buffer
+		 * Top-down merge sort. The left half of each merge is copied into buf and merged back,
+		 * taking the left element on ties so equal elements keep their order.
+		 * When no buffer can be allocated the halves are merged in place with rotations, O(n log^2 n).
+		 */
+		template <typename RandomAccessIterator, typename Pointer, typename Compare>
+		void merge_sort_buffered(RandomAccessIterator first, RandomAccessIterator last, Pointer buf, Compare comp) {
+			if (last - first <= sort_threshold) {
+				detail::insertion_sort(first, last, comp);
+				return;
+			}
+			RandomAccessIterator middle = first + (last - first) / 2;
+			detail::merge_sort_buffered(first, middle, buf, comp);
+			detail::merge_sort_buffered(middle, last, buf, comp);
+			if (!comp(*middle, *(middle - 1)))
+				return;
+			Pointer buf_last = std::copy(first, middle, buf);
+			Pointer left = buf;
+			RandomAccessIterator right = middle;
+			RandomAccessIterator out = first;
+			while (left != buf_last && right != last) {
+				if (comp(*right, *left))
+					*out++ = *right++;
+				else
+					*out++ = *left++;
+			}
+			std::copy(left, buf_last, out);
+		}
+
+		template <typename RandomAccessIterator, typename Compare>
+		void merge_without_buffer(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare comp) {
+			if (first == middle || middle == last)
+				return;
+			if (last - first == 2) {
+				if (comp(*middle, *first))
+					detail::swap_elements(first, middle);
+				return;
+			}
+			RandomAccessIterator left_cut = first;
+			RandomAccessIterator right_cut = middle;
+			if (middle - first > last - middle) {
+				left_cut += (middle - first) / 2;
+				right_cut = std::lower_bound(middle, last, *left_cut, comp);
+			}
+			else {
+				right_cut += (last - middle) / 2;
+				left_cut = std::upper_bound(first, middle, *right_cut, comp);
+			}
+			std::rotate(left_cut, middle, right_cut);
+			RandomAccessIterator new_middle = left_cut + (right_cut - middle);
+			detail::merge_without_buffer(first, left_cut, new_middle, comp);
+			detail::merge_without_buffer(new_middle, right_cut, last, comp);
+		}
+
+		template <typename RandomAccessIterator, typename Compare>
+		void merge_sort_in_place(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
+			if (last - first <= sort_threshold) {
+				detail::insertion_sort(first, last, comp);
+				return;
+			}
+			RandomAccessIterator middle = first + (last - first) / 2;
+			detail::merge_sort_in_place(first, middle, comp);
+			detail::merge_sort_in_place(middle, last, comp);
+			detail::merge_without_buffer(first, middle, last, comp);
+		}
+	} // namespace detail
+
+	/**
+	 * @brief sort
+	 * Sorts [first, last) in ascending order by comp (default: ft::less), equal elements in any order.
+	 * Introsort: quicksort on the median of three, heapsort when the recursion gets deeper than 2 log n,
+	 * insertion sort on the ranges of at most detail::sort_threshold elements left at the end.
+	 * O(n log n) comparisons in the worst case.
+	 * 
+	 * @tparam RandomAccessIterator	random-access iterator
+	 * @tparam Compare							binary predicate, strict weak ordering
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
+		if (last - first < 2)
+			return;
+		detail::introsort_loop(first, last, detail::sort_depth_limit(last - first), comp);
+		detail::insertion_sort(first, last, comp);
+	}
+
+	template <typename RandomAccessIterator>
+	void sort(RandomAccessIterator first, RandomAccessIterator last) {
+		ft::sort(first, last, ft::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/**
+	 * @brief partial_sort
+	 * Puts the middle - first smallest elements of [first, last) in ascending order at [first, middle),
+	 * the others are left in [middle, last) in no particular order. Heap selection, O(n log k).
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, Compare comp) {
+		typedef typename ft::iterator_traits<RandomAccessIterator>::difference_type	difference_type;
+		if (first == middle)
+			return;
+		detail::make_heap(first, middle, comp);
+		for (RandomAccessIterator it = middle; it < last; ++it) {
+			if (comp(*it, *first)) {
+				detail::swap_elements(first, it);
+				detail::sift_down(first, difference_type(0), difference_type(middle - first), comp);
+			}
+		}
+		detail::sort_heap(first, middle, comp);
+	}
+
+	template <typename RandomAccessIterator>
+	void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last) {
+		ft::partial_sort(first, middle, last, ft::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/**
+	 * @brief nth_element
+	 * Puts at nth the element that a sort would put there, no element before it is greater
+	 * and no element after it is less. Introselect: the partitions of sort, following only
+	 * the side that holds nth, with the heap selection of partial_sort as the fallback. O(n) on average.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, Compare comp) {
+		if (nth == last)
+			return;
+		typename ft::iterator_traits<RandomAccessIterator>::difference_type depth = detail::sort_depth_limit(last - first);
+		while (last - first > 3) {
+			if (depth-- == 0) {
+				ft::partial_sort(first, nth + 1, last, comp);
+				return;
+			}
+			RandomAccessIterator cut = detail::partition_pivot(first, last, comp);
+			if (cut <= nth)
+				first = cut;
+			else
+				last = cut;
+		}
+		detail::insertion_sort(first, last, comp);
+	}
+
+	template <typename RandomAccessIterator>
+	void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last) {
+		ft::nth_element(first, nth, last, ft::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/**
+	 * @brief stable_sort
+	 * Sorts [first, last) like sort, equal elements keep their relative order.
+	 * Merge sort through a buffer of half the range, copy-constructed once from the range
+	 * and then reused by assignment. O(n log n), O(n log^2 n) without the buffer.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp) {
+		typedef typename ft::iterator_traits<RandomAccessIterator>::value_type	value_type;
+		if (last - first <= detail::sort_threshold) {
+			detail::insertion_sort(first, last, comp);
+			return;
+		}
+		std::allocator<value_type> alloc;
+		size_t len = (last - first + 1) / 2;
+		value_type* buf;
+		try {
+			buf = alloc.allocate(len);
+		}
+		catch (std::bad_alloc&) {
+			detail::merge_sort_in_place(first, last, comp);
+			return;
+		}
+		try {
+			std::uninitialized_copy(first, first + len, buf);
+		}
+		catch (...) {
+			alloc.deallocate(buf, len);
+			throw;
+		}
+		try {
+			detail::merge_sort_buffered(first, last, buf, comp);
+		}
+		catch (...) {
+			for (size_t i = 0; i < len; ++i)
+				alloc.destroy(buf + i);
+			alloc.deallocate(buf, len);
+			throw;
+		}
+		for (size_t i = 0; i < len; ++i)
+			alloc.destroy(buf + i);
+		alloc.deallocate(buf, len);
+	}
+
+	template <typename RandomAccessIterator>
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last) {
+		ft::stable_sort(first, last, ft::less<typename ft::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/**
+	 * @brief VectorIterator overloads
+	 * VectorIterator has a virtual destructor, so every copy the algorithms make of it is not free.
+	 * The vector elements are contiguous, the algorithms run on the underlying pointers instead.
+	 */
+	template <typename T, typename Compare>
+	void sort(VectorIterator<T> first, VectorIterator<T> last, Compare comp) { ft::sort(first.base(), last.base(), comp); }
+
+	template <typename T>
+	void sort(VectorIterator<T> first, VectorIterator<T> last) { ft::sort(first.base(), last.base(), ft::less<T>()); }
+
+	template <typename T, typename Compare>
+	void stable_sort(VectorIterator<T> first, VectorIterator<T> last, Compare comp) {
+		ft::stable_sort(first.base(), last.base(), comp);
+	}
+
+	template <typename T>
+	void stable_sort(VectorIterator<T> first, VectorIterator<T> last) { ft::stable_sort(first.base(), last.base(), ft::less<T>()); }
+
+	template <typename T, typename Compare>
+	void partial_sort(VectorIterator<T> first, VectorIterator<T> middle, VectorIterator<T> last, Compare comp) {
+		ft::partial_sort(first.base(), middle.base(), last.base(), comp);
+	}
+
+	template <typename T>
+	void partial_sort(VectorIterator<T> first, VectorIterator<T> middle, VectorIterator<T> last) {
+		ft::partial_sort(first.base(), middle.base(), last.base(), ft::less<T>());
+	}
+
+	template <typename T, typename Compare>
+	void nth_element(VectorIterator<T> first, VectorIterator<T> nth, VectorIterator<T> last, Compare comp) {
+		ft::nth_element(first.base(), nth.base(), last.base(), comp);
+	}
+
+	template <typename T>
+	void nth_element(VectorIterator<T> first, VectorIterator<T> nth, VectorIterator<T> last) {
+		ft::nth_element(first.base(), nth.base(), last.base(), ft::less<T>());
+	}
+}
+
+#endif
@@ -26,6 +26,8 @@ namespace ft
 		typedef Compare													key_compare;
 
 		class value_compare : binary_function<value_type, value_type, bool> {
+			friend class map;
+
 		protected:
 			Compare comp;
 			value_compare(Compare c) : comp(c) {}  // constructed with map's comparison object
@@ -49,7 +51,7 @@ namespace ft
 		typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
 		typedef typename allocator_type::difference_type		difference_type;
 		typedef typename allocator_type::size_type					size_type;
-		typedef ft::MapTree<value_type, value_compare>			rb_tree;
+		typedef ft::MapTree<Key, value_type, ft::select_first<value_type>, key_compare, allocator_type>	rb_tree;
 		typedef ft::RBTreeNode<value_type>									node_type;
 
 		/**
@@ -58,7 +60,7 @@ namespace ft
 		// Empty constructor
 		explicit map (const key_compare& comp = key_compare(),
 									const allocator_type& alloc = allocator_type())
-									: _alloc(alloc), _tree(), _comp(comp) {}
+									: _tree(comp, alloc) {}
 
 		// Range constructor
 		template <class InputIterator>
@@ -66,10 +68,17 @@ namespace ft
 				const key_compare& comp = key_compare(),
 				const allocator_type& alloc = allocator_type(),
 				typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr)
-				: _alloc(alloc), _tree(), _comp(comp) { insert(first, last); }
+				: _tree(comp, alloc) { insert(first, last); }
+
+		// Sorted range constructor, [first, last) must be sorted and unique.
+		template <class InputIterator>
+		map (ft::sorted_unique_t, InputIterator first, InputIterator last,
+				const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type())
+				: _tree(comp, alloc) { insert(ft::sorted_unique, first, last); }
 
 		// Copy constructor
-		map (const map& x) : _alloc(x._alloc), _tree(), _comp(x._comp) { *this = x; }
+		map (const map& x) : _tree(x._tree) {}
 
 		// Destructor
 		~map() {}
@@ -94,7 +103,11 @@ namespace ft
 
 		// Element access:
 		mapped_type& operator[](const key_type& k) {
-			return (*(_tree.insert(ft::make_pair(k, mapped_type())).first)).value->second;
+			iterator it = lower_bound(k);
+			// Only a missing key builds a value, lower_bound is the hint for its position.
+			if (it == end() || _tree.key_comp()(k, it->first))
+				it = insert(it, value_type(k, mapped_type()));
+			return it->second;
 		}
 		pair<iterator, bool>	insert(const value_type& val) {
 			ft::pair<node_type*, bool> res = _tree.insert(val);
@@ -106,12 +119,19 @@ namespace ft
 		template <class InputIterator>
 		void									insert(InputIterator first, InputIterator last,
 		typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr) {
-			while (first != last)
-				_tree.insert(*first++);
+			_tree.insert_range(first, last);
 		}	// range
-		void			erase(iterator position) { _tree.erase(position.base()); }
-		size_type	erase(const key_type& k) { return _tree.erase(_tree.find(value_type(k, mapped_type()))); }
+		template <class InputIterator>
+		void									insert(ft::sorted_unique_t, InputIterator first, InputIterator last) {
+			_tree.insert_range(first, last, true);
+		}	// sorted and unique range
+		void			erase(iterator position) { _tree.erase_node(position.base()); }
+		size_type	erase(const key_type& k) { return _tree.erase(_tree.find(k)); }
 		void			erase(iterator first, iterator last) {
+			if (first == begin() && last == end()) {
+				clear();
+				return;
+			}
 			while (first != last)
 				erase(first++);
 		}
@@ -119,22 +139,63 @@ namespace ft
 		void clear() { _tree.clear(); }
 
 		// Observers:
-		key_compare		key_comp() const { return key_compare(); }
-		value_compare	value_comp() const { return value_compare(); }
+		key_compare		key_comp() const { return _tree.key_comp(); }
+		value_compare	value_comp() const { return value_compare(_tree.key_comp()); }
 
 		// Operations:
-		iterator				find(const key_type& k) { return iterator(_tree.find(value_type(k, mapped_type()))); }
-		const_iterator	find(const key_type& k) const { return const_iterator(_tree.find(value_type(k, mapped_type()))); }
-		size_type				count(const key_type& k) const { if (_tree.find(value_type(k, mapped_type()))->value != ft_nullptr) return 1; else return 0; }
-		iterator				lower_bound(const key_type& k) { return iterator(_tree.lower_bound(value_type(k, mapped_type()))); }
-		const_iterator	lower_bound(const key_type& k) const { return const_iterator(_tree.lower_bound(value_type(k, mapped_type()))); }
-		iterator				upper_bound(const key_type& k) { return iterator(_tree.upper_bound(value_type(k, mapped_type()))); }
-		const_iterator	upper_bound(const key_type& k) const { return const_iterator(_tree.upper_bound(value_type(k, mapped_type()))); }
-		pair<iterator, iterator>							equal_range(const key_type& k) { return ft::make_pair(lower_bound(k), upper_bound(k)); }
-		pair<const_iterator, const_iterator>	equal_range(const key_type& k) const { return ft::make_pair(lower_bound(k), upper_bound(k)); }
+		iterator				find(const key_type& k) { return iterator(_tree.find(k)); }
+		const_iterator	find(const key_type& k) const { return const_iterator(_tree.find(k)); }
+		size_type				count(const key_type& k) const { if (_tree.find(k) != _tree.get_end()) return 1; else return 0; }
+		iterator				lower_bound(const key_type& k) { return iterator(_tree.lower_bound(k)); }
+		const_iterator	lower_bound(const key_type& k) const { return const_iterator(_tree.lower_bound(k)); }
+		iterator				upper_bound(const key_type& k) { return iterator(_tree.upper_bound(k)); }
+		const_iterator	upper_bound(const key_type& k) const { return const_iterator(_tree.upper_bound(k)); }
+		pair<iterator, iterator>							equal_range(const key_type& k) {
+			ft::pair<node_type*, node_type*> res = _tree.equal_range(k);
+			return ft::make_pair(iterator(res.first), iterator(res.second));
+		}
+		pair<const_iterator, const_iterator>	equal_range(const key_type& k) const {
+			ft::pair<node_type*, node_type*> res = _tree.equal_range(k);
+			return ft::make_pair(const_iterator(res.first), const_iterator(res.second));
+		}
+
+		// Heterogeneous lookup, only when key_compare is transparent (e.g. ft::less<>).
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+		find(const K& k) { return iterator(_tree.find(k)); }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+		find(const K& k) const { return const_iterator(_tree.find(k)); }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+		count(const K& k) const { if (_tree.find(k) != _tree.get_end()) return 1; else return 0; }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+		lower_bound(const K& k) { return iterator(_tree.lower_bound(k)); }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+		lower_bound(const K& k) const { return const_iterator(_tree.lower_bound(k)); }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+		upper_bound(const K& k) { return iterator(_tree.upper_bound(k)); }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+		upper_bound(const K& k) const { return const_iterator(_tree.upper_bound(k)); }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<iterator, iterator> >::type
+		equal_range(const K& k) {
+			ft::pair<node_type*, node_type*> res = _tree.equal_range(k);
+			return ft::make_pair(iterator(res.first), iterator(res.second));
+		}
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<const_iterator, const_iterator> >::type
+		equal_range(const K& k) const {
+			ft::pair<node_type*, node_type*> res = _tree.equal_range(k);
+			return ft::make_pair(const_iterator(res.first), const_iterator(res.second));
+		}
 
 		// Allocator:
-		allocator_type get_allocator() const { return _alloc; }
+		allocator_type get_allocator() const { return _tree.get_allocator(); }
 
 		void showTree() { _tree.showMap(); }
 
@@ -142,9 +203,7 @@ namespace ft
 		 * @brief Member variables
 		 */
 	private:
-		allocator_type	_alloc;
-		rb_tree					_tree;
-		key_compare			_comp;
+		rb_tree	_tree;	// Owns the comparator and the allocator.
 	};
 
 	/**
@@ -183,6 +242,10 @@ namespace ft
 	// swap
 	template <class Key, class T, class Compare, class Alloc>
 	void swap(map<Key, T, Compare, Alloc>& x, map<Key, T, Compare, Alloc>& y) { x.swap(y); }
+
+	// A map moves by swapping its tree.
+	template <class Key, class T, class Compare, class Alloc>
+	struct is_swap_relocatable<map<Key, T, Compare, Alloc> > { enum _value { value = true }; };
 } // namespace ft
 
 #endif
@@ -0,0 +1,150 @@
+#ifndef MMAP_ALLOCATOR_HPP
+#define MMAP_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include "utils.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <sys/mman.h>
+# include <unistd.h>
+# define FT_HAS_MMAP 1
+#endif
+
+namespace ft
+{
+	/**
+	 * @brief mmap_allocator class
+	 * Maps buffers of at least MinMapBytes straight from the kernel with mmap, smaller ones come from operator new.
+	 * On Linux a mapped buffer grows with mremap, the kernel moves the pages instead of the bytes,
+	 * so a vector of relocatable elements grows without copying and without holding two buffers at once.
+	 * Other systems map and unmap but cannot grow in place, vector then falls back to allocate and copy.
+	 * The allocator holds no state, all instances are interchangeable.
+	 * 
+	 * @tparam T						Type of the elements.(value_type)
+	 * @tparam HugePages		Asks for transparent huge pages on the mapped buffers (MADV_HUGEPAGE), a hint only.
+	 * @tparam MinMapBytes	Smallest buffer that is mapped, in bytes.
+	 */
+	template < class T, bool HugePages = false, size_t MinMapBytes = 2 * 1024 * 1024 >
+	class mmap_allocator {
+	public :
+		/**
+		 * @brief Member types
+		 */
+		typedef T					value_type;
+		typedef T*				pointer;
+		typedef const T*	const_pointer;
+		typedef T&				reference;
+		typedef const T&	const_reference;
+		typedef size_t		size_type;
+		typedef ptrdiff_t	difference_type;
+
+		template <class U>
+		struct rebind { typedef mmap_allocator<U, HugePages, MinMapBytes> other; };
+
+		/**
+		 * @brief Member functions
+		 */
+		mmap_allocator() throw() {}
+		mmap_allocator(const mmap_allocator&) throw() {}
+		template <class U>
+		mmap_allocator(const mmap_allocator<U, HugePages, MinMapBytes>&) throw() {}
+		~mmap_allocator() {}
+
+		mmap_allocator& operator=(const mmap_allocator&) throw() { return *this; }
+
+		pointer address(reference x) const { return &x; }
+		const_pointer address(const_reference x) const { return &x; }
+		size_type max_size() const throw() { return size_type(-1) / sizeof(T); }
+		void construct(pointer p, const_reference val) { new(static_cast<void*>(p)) T(val); }
+		void destroy(pointer p) { p->~T(); }
+
+		pointer allocate(size_type n, const void* hint = 0) {
+			(void)hint;
+			if (n > max_size())
+				throw std::bad_alloc();
+#ifdef FT_HAS_MMAP
+			if (mapped(n)) {
+				void* res = ::mmap(ft_nullptr, map_size(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (res == MAP_FAILED)
+					throw std::bad_alloc();
+				advise(res, map_size(n));
+				return static_cast<pointer>(res);
+			}
+#endif
+			return static_cast<pointer>(::operator new(n * sizeof(T)));
+		}
+
+		void deallocate(pointer p, size_type n) {
+#ifdef FT_HAS_MMAP
+			if (mapped(n)) {
+				::munmap(p, map_size(n));
+				return;
+			}
+#endif
+			::operator delete(p);
+		}
+
+		// Grows a buffer from allocate(old_n) to new_n elements keeping its bytes, the result may have moved.
+		// Returns null when it cannot be done without a copy, p is then untouched.
+		pointer reallocate(pointer p, size_type old_n, size_type new_n) {
+#if defined(FT_HAS_MMAP) && defined(__linux__)
+			if (mapped(old_n) && mapped(new_n) && new_n <= max_size()) {
+				void* res = ::mremap(p, map_size(old_n), map_size(new_n), MREMAP_MAYMOVE);
+				if (res == MAP_FAILED)
+					throw std::bad_alloc();
+				advise(res, map_size(new_n));
+				return static_cast<pointer>(res);
+			}
+#endif
+			(void)p;
+			(void)old_n;
+			(void)new_n;
+			return ft_nullptr;
+		}
+
+	private :
+		static bool mapped(size_type n) {
+#ifdef FT_HAS_MMAP
+			return n * sizeof(T) >= MinMapBytes;
+#else
+			(void)n;
+			return false;
+#endif
+		}
+
+#ifdef FT_HAS_MMAP
+		// Mappings are whole pages.
+		static size_t map_size(size_type n) {
+			static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+			return (n * sizeof(T) + page - 1) / page * page;
+		}
+
+		static void advise(void* addr, size_t len) {
+#ifdef MADV_HUGEPAGE
+			if (HugePages)
+				::madvise(addr, len, MADV_HUGEPAGE);
+#else
+			(void)addr;
+			(void)len;
+#endif
+		}
+#endif
+	};
+
+	template <class T1, class T2, bool H, size_t M>
+	inline bool operator==(const mmap_allocator<T1, H, M>&, const mmap_allocator<T2, H, M>&) { return true; }
+
+	template <class T1, class T2, bool H, size_t M>
+	inline bool operator!=(const mmap_allocator<T1, H, M>&, const mmap_allocator<T2, H, M>&) { return false; }
+
+	// mmap_allocator grows its mappings in place, see reallocate_in_place in utils.hpp.
+	template <class T, bool H, size_t M>
+	struct reallocate_in_place< mmap_allocator<T, H, M> > {
+		static T* reallocate(mmap_allocator<T, H, M>& alloc, T* p, size_t old_n, size_t new_n) {
+			return alloc.reallocate(p, old_n, new_n);
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include "utils.hpp"
+
+namespace ft
+{
+	namespace detail
+	{
+		// A free slot holds the next free slot, the first slot of a slab links the previous slab.
+		struct pool_link {
+			pool_link*	next;
+		};
+
+		// Slabs of one slot size, shared by every allocator of the arena whose slots have that size.
+		struct pool {
+			pool_link*	free_list;
+			pool_link*	last_slab;
+			size_t			slot_size;
+			size_t			slabs;
+			size_t			users;
+			pool*				next;
+			pool(size_t size, pool* next_pool)
+				: free_list(ft_nullptr), last_slab(ft_nullptr), slot_size(size), slabs(0), users(0), next(next_pool) {}
+		};
+
+		// State shared by an allocator, its copies and its rebound copies.
+		struct pool_arena {
+			pool*		pools;
+			size_t	refs;
+			pool_arena() : pools(ft_nullptr), refs(1) {}
+		};
+	}
+
+	/**
+	 * @brief pool_allocator class
+	 * Hands out single objects from slabs of SlabSlots slots and recycles them through a free list,
+	 * so a tree of n nodes costs about n / SlabSlots calls to operator new.
+	 * Requests for more than one object go to operator new directly.
+	 * Copies and rebound copies share one arena holding a pool per slot size, so A(B(a)) == a.
+	 * An allocator joins the pool of its slot size on first use, one that never allocates builds none.
+	 * 
+	 * @tparam T					Type of the elements.(value_type)
+	 * @tparam SlabSlots	Number of objects in one slab.
+	 */
+	template < class T, size_t SlabSlots = 256 >
+	class pool_allocator {
+	public :
+		/**
+		 * @brief Member types
+		 */
+		typedef T					value_type;
+		typedef T*				pointer;
+		typedef const T*	const_pointer;
+		typedef T&				reference;
+		typedef const T&	const_reference;
+		typedef size_t		size_type;
+		typedef ptrdiff_t	difference_type;
+
+		template <class U>
+		struct rebind { typedef pool_allocator<U, SlabSlots> other; };
+
+		/**
+		 * @brief Member functions
+		 */
+		pool_allocator() : _arena(new detail::pool_arena()), _pool(ft_nullptr) {}
+		pool_allocator(const pool_allocator& x) throw() : _arena(x._arena), _pool(x._pool) { share(); }
+		template <class U>
+		pool_allocator(const pool_allocator<U, SlabSlots>& x) throw() : _arena(x._arena), _pool(ft_nullptr) { share(); }
+		~pool_allocator() { drop(); }
+
+		pool_allocator& operator=(const pool_allocator& x) {
+			if (this != &x) {
+				drop();
+				_arena = x._arena;
+				_pool = x._pool;
+				share();
+			}
+			return *this;
+		}
+
+		pointer address(reference x) const { return &x; }
+		const_pointer address(const_reference x) const { return &x; }
+		size_type max_size() const throw() { return size_type(-1) / sizeof(T); }
+		void construct(pointer p, const_reference val) { new(static_cast<void*>(p)) T(val); }
+		void destroy(pointer p) { p->~T(); }
+
+		pointer allocate(size_type n, const void* hint = 0) {
+			(void)hint;
+			if (n != 1)
+				return static_cast<pointer>(::operator new(n * sizeof(T)));
+			detail::pool* p = join();
+			if (p->free_list == ft_nullptr)
+				add_slab(p);
+			detail::pool_link* res = p->free_list;
+			p->free_list = res->next;
+			return reinterpret_cast<pointer>(res);
+		}
+
+		void deallocate(pointer p, size_type n) {
+			if (n != 1) {
+				::operator delete(p);
+				return;
+			}
+			detail::pool* owner = join();
+			detail::pool_link* s = reinterpret_cast<detail::pool_link*>(p);
+			s->next = owner->free_list;
+			owner->free_list = s;
+		}
+
+		// Frees every slab of this slot size at once, in O(number of slabs). The objects in the pool
+		// must not need their destructor any more. Refused (false) while another allocator uses the pool.
+		bool release() {
+			detail::pool* p = join();
+			if (p->users != 1)
+				return false;
+			free_slabs(p);
+			return true;
+		}
+
+		// Number of slabs the pool of this slot size holds.
+		size_type slab_count() const {
+			const detail::pool* p = (_pool != ft_nullptr) ? _pool : find();
+			return (p != ft_nullptr) ? p->slabs : 0;
+		}
+
+		template <class U, size_t N>
+		friend class pool_allocator;
+		template <class T1, class T2, size_t N>
+		friend bool operator==(const pool_allocator<T1, N>& lhs, const pool_allocator<T2, N>& rhs);
+
+	private :
+		// Same size as a union of T and a link, so a slab is an array of slots.
+		static size_type slot_size() {
+			const size_type link = sizeof(detail::pool_link);
+			return (sizeof(T) + link - 1) / link * link;
+		}
+
+		detail::pool* find() const {
+			detail::pool* p = _arena->pools;
+			while (p != ft_nullptr && p->slot_size != slot_size())
+				p = p->next;
+			return p;
+		}
+
+		// The pool of this slot size, added to the arena the first time it is needed.
+		detail::pool* join() {
+			if (_pool == ft_nullptr) {
+				_pool = find();
+				if (_pool == ft_nullptr) {
+					_pool = new detail::pool(slot_size(), _arena->pools);
+					_arena->pools = _pool;
+				}
+				_pool->users++;
+			}
+			return _pool;
+		}
+
+		void share() {
+			_arena->refs++;
+			if (_pool != ft_nullptr)
+				_pool->users++;
+		}
+
+		static void add_slab(detail::pool* p) {
+			char* slab = static_cast<char*>(::operator new((SlabSlots + 1) * p->slot_size));
+			detail::pool_link* link = reinterpret_cast<detail::pool_link*>(slab);
+			link->next = p->last_slab;
+			p->last_slab = link;
+			p->slabs++;
+			// Slot 0 is the link, the others are chained in address order.
+			for (size_type i = SlabSlots; i > 0; --i) {
+				detail::pool_link* s = reinterpret_cast<detail::pool_link*>(slab + i * p->slot_size);
+				s->next = p->free_list;
+				p->free_list = s;
+			}
+		}
+
+		static void free_slabs(detail::pool* p) {
+			while (p->last_slab != ft_nullptr) {
+				detail::pool_link* prev = p->last_slab->next;
+				::operator delete(p->last_slab);
+				p->last_slab = prev;
+			}
+			p->free_list = ft_nullptr;
+			p->slabs = 0;
+		}
+
+		// A pool nobody uses keeps its slabs until the arena goes, with the last allocator sharing it.
+		void drop() {
+			if (_pool != ft_nullptr)
+				_pool->users--;
+			if (--_arena->refs != 0)
+				return;
+			while (_arena->pools != ft_nullptr) {
+				detail::pool* next = _arena->pools->next;
+				free_slabs(_arena->pools);
+				delete _arena->pools;
+				_arena->pools = next;
+			}
+			delete _arena;
+		}
+
+		detail::pool_arena*	_arena;
+		detail::pool*				_pool;
+	};
+
+	// Memory from one arena can be deallocated through any allocator sharing it.
+	template <class T1, class T2, size_t N>
+	inline bool operator==(const pool_allocator<T1, N>& lhs, const pool_allocator<T2, N>& rhs) {
+		return lhs._arena == rhs._arena;
+	}
+
+	template <class T1, class T2, size_t N>
+	inline bool operator!=(const pool_allocator<T1, N>& lhs, const pool_allocator<T2, N>& rhs) { return !(lhs == rhs); }
+
+	/**
+	 * @brief release_all
+	 * Lets a container drop all its nodes at once when its allocator supports it.
+	 * Returns false for any other allocator, the nodes are then freed one by one.
+	 * 
+	 * @tparam Alloc	Type of the node allocator
+	 */
+	template <class Alloc>
+	struct release_all {
+		static bool release(Alloc&) { return false; }
+	};
+
+	template <class T, size_t N>
+	struct release_all< pool_allocator<T, N> > {
+		static bool release(pool_allocator<T, N>& alloc) { return alloc.release(); }
+	};
+}
+
+#endif
@@ -15,7 +15,7 @@ void printMap(RBTreeNode< T >* node, int depth) {
     std::cout << "// SHOW TREE //" << std::endl;
   }
   int tmp_depth = depth;
-  if (node->value == ft_nullptr) {
+  if (node->is_nil()) {
     while (tmp_depth--) {
       std::cout << "     ";
     }
@@ -26,13 +26,13 @@ void printMap(RBTreeNode< T >* node, int depth) {
     std::cout << "     ";
   }
   std::cout << (node->color ? C_RESET : C_RED)
-            << (node->parent->value == ft_nullptr ? "Root" : (node->parent->left_child == node ? "L" : "R"))
-            << " - key: " << node->value->first << C_RESET << std::endl;
-  if (node->left_child->value != ft_nullptr) {
+            << (node->parent->is_nil() ? "Root" : (node->parent->left_child == node ? "L" : "R"))
+            << " - key: " << node->value.first << C_RESET << std::endl;
+  if (!node->left_child->is_nil()) {
     // std::cout << "left?" << std::endl;
     printMap(node->left_child, depth + 1);
   }
-  if (node->right_child->value != ft_nullptr) {
+  if (!node->right_child->is_nil()) {
     printMap(node->right_child, depth + 1);
   }
     // std::cout << "right?" << std::endl;
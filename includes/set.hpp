@@ -11,8 +11,8 @@ namespace ft
 		/**
 		 * @brief Member types
 		 */
-		typedef const T																			key_type;
-		typedef const T																			value_type;
+		typedef T																						key_type;
+		typedef T																						value_type;
 		typedef Compare																			key_compare;
 		typedef Compare																			value_compare;
 		typedef Alloc																				allocator_type;
@@ -26,7 +26,7 @@ namespace ft
 		typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
 		typedef typename allocator_type::difference_type		difference_type;
 		typedef typename allocator_type::size_type					size_type;
-		typedef ft::SetTree<value_type, value_compare>			rb_tree;
+		typedef ft::SetTree<T, value_type, ft::identity<value_type>, key_compare, allocator_type>	rb_tree;
 		typedef ft::RBTreeNode<value_type>									node_type;
 
 		/**
@@ -35,7 +35,7 @@ namespace ft
 		// Empty constructor
 		explicit set (const key_compare& comp = key_compare(),
 									const allocator_type& alloc = allocator_type())
-									: _alloc(alloc), _tree(), _comp(comp) {}
+									: _tree(comp, alloc) {}
 
 		// Range constructor
 		template <class InputIterator>
@@ -43,10 +43,17 @@ namespace ft
 				const key_compare& comp = key_compare(),
 				const allocator_type& alloc = allocator_type(),
 				typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr)
-				: _alloc(alloc), _tree(), _comp(comp) { insert(first, last); }
+				: _tree(comp, alloc) { insert(first, last); }
+
+		// Sorted range constructor, [first, last) must be sorted and unique.
+		template <class InputIterator>
+		set (ft::sorted_unique_t, InputIterator first, InputIterator last,
+				const key_compare& comp = key_compare(),
+				const allocator_type& alloc = allocator_type())
+				: _tree(comp, alloc) { insert(ft::sorted_unique, first, last); }
 
 		// Copy constructor
-		set (const set& x) : _alloc(x._alloc), _tree(), _comp(x._comp) { *this = x; }
+		set (const set& x) : _tree(x._tree) {}
 
 		// Destructor
 		~set() {}
@@ -80,12 +87,19 @@ namespace ft
 		template <class InputIterator>
 		void									insert(InputIterator first, InputIterator last,
 		typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr) {
-			while (first != last)
-				_tree.insert(*first++);
+			_tree.insert_range(first, last);
 		}	// range
-		void			erase(iterator position) { _tree.erase(position.base()); }
+		template <class InputIterator>
+		void									insert(ft::sorted_unique_t, InputIterator first, InputIterator last) {
+			_tree.insert_range(first, last, true);
+		}	// sorted and unique range
+		void			erase(iterator position) { _tree.erase_node(position.base()); }
 		size_type	erase(const value_type& val) { return _tree.erase(_tree.find(val)); }
 		void			erase(iterator first, iterator last) {
+			if (first == begin() && last == end()) {
+				clear();
+				return;
+			}
 			while (first != last)
 				erase(first++);
 		}
@@ -93,26 +107,47 @@ namespace ft
 		void clear() { _tree.clear(); }
 
 		// Observers:
-		key_compare		key_comp() const { return key_compare(); }
-		value_compare	value_comp() const { return value_compare(); }
+		key_compare		key_comp() const { return _tree.key_comp(); }
+		value_compare	value_comp() const { return _tree.key_comp(); }
 
 		// Operations:
 		iterator	find(const value_type& val) const { return iterator(_tree.find(val)); }
-		size_type	count(const value_type& val) const { if (_tree.find(val)->value != ft_nullptr) return 1; else return 0; }
+		size_type	count(const value_type& val) const { if (_tree.find(val) != _tree.get_end()) return 1; else return 0; }
 		iterator	lower_bound(const value_type& val) const { return iterator(_tree.lower_bound(val)); }
 		iterator	upper_bound(const value_type& val) const { return iterator(_tree.upper_bound(val)); }
-		pair<iterator,iterator> equal_range(const value_type& val) const { return ft::make_pair(lower_bound(val), upper_bound(val)); }
+		pair<iterator,iterator> equal_range(const value_type& val) const {
+			ft::pair<node_type*, node_type*> res = _tree.equal_range(val);
+			return ft::make_pair(iterator(res.first), iterator(res.second));
+		}
+
+		// Heterogeneous lookup, only when key_compare is transparent (e.g. ft::less<>).
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+		find(const K& k) const { return iterator(_tree.find(k)); }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+		count(const K& k) const { if (_tree.find(k) != _tree.get_end()) return 1; else return 0; }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+		lower_bound(const K& k) const { return iterator(_tree.lower_bound(k)); }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+		upper_bound(const K& k) const { return iterator(_tree.upper_bound(k)); }
+		template <class K>
+		typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<iterator, iterator> >::type
+		equal_range(const K& k) const {
+			ft::pair<node_type*, node_type*> res = _tree.equal_range(k);
+			return ft::make_pair(iterator(res.first), iterator(res.second));
+		}
 
 		// Allocator:
-		allocator_type get_allocator() const { return _alloc; }
+		allocator_type get_allocator() const { return _tree.get_allocator(); }
 
 		/**
 		 * @brief Member variables
 		 */
 	private:
-		allocator_type	_alloc;
-		rb_tree					_tree;
-		value_compare		_comp;
+		rb_tree	_tree;	// Owns the comparator and the allocator.
 	};
 
 	/**
@@ -151,6 +186,10 @@ namespace ft
 	// swap
 	template <class T, class Compare, class Alloc>
 	void swap(set<T, Compare, Alloc>& x, set<T, Compare, Alloc>& y) { x.swap(y); }
+
+	// A set moves by swapping its tree.
+	template <class T, class Compare, class Alloc>
+	struct is_swap_relocatable<set<T, Compare, Alloc> > { enum _value { value = true }; };
 } // namespace ft
 
 #endif
@@ -0,0 +1,500 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include "VectorBuffer.hpp"
+#include "VectorIterator.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	/**
+	 * @brief small_vector class
+	 * A vector that keeps up to N elements in a buffer inside the object and only
+	 * allocates once it grows past N. Short-lived vectors that stay small never touch the heap.
+	 * The interface is the one of ft::vector, iterators stay valid until the next reallocation,
+	 * which here includes the move from the inline buffer to the heap.
+	 * The inline buffer is aligned like long double, which covers the fundamental types.
+	 * 
+	 * @tparam T			Type of the elements.(value_type)
+	 * @tparam N			Number of elements stored inline.
+	 * @tparam Alloc	Type of the allocator object used once the elements spill to the heap.(allocator_type)
+	 */
+	template < class T, size_t N, class Alloc = std::allocator<T> >
+	class small_vector {
+	public:
+		/**
+		 * @brief Member types
+		 */
+		typedef T																					value_type;
+		typedef Alloc																			allocator_type;
+		typedef typename allocator_type::reference				reference;
+		typedef typename allocator_type::const_reference	const_reference;
+		typedef typename allocator_type::pointer					pointer;
+		typedef typename allocator_type::const_pointer		const_pointer;
+		typedef ft::VectorIterator<value_type>						iterator;
+		typedef ft::VectorIterator<const value_type>			const_iterator;
+		typedef ft::reverse_iterator<iterator>						reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+		typedef typename allocator_type::difference_type	difference_type;
+		typedef typename allocator_type::size_type				size_type;
+
+		static const size_type inline_capacity = N;
+
+		/**
+		 * @brief Member functions
+		 */
+		// Default constructor
+		explicit small_vector(const allocator_type& alloc = allocator_type())
+		: _alloc(alloc) { init_inline(); }
+
+		// Fill constructor
+		explicit small_vector(size_type n, const value_type& val = value_type(),
+													const allocator_type& alloc = allocator_type())
+		: _alloc(alloc) {
+			init_inline();
+			try {
+				assign(n, val);
+			}
+			catch (...) {
+				release();
+				throw;
+			}
+		}
+
+		// Range constructor
+		template <class InputIterator>
+		small_vector(InputIterator first, InputIterator last,
+								const allocator_type& alloc = allocator_type(),
+								typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr)
+		: _alloc(alloc) {
+			init_inline();
+			try {
+				assign(first, last);
+			}
+			catch (...) {
+				release();
+				throw;
+			}
+		}
+
+		// Copy constructor
+		small_vector(const small_vector& x)
+		: _alloc(x._alloc) {
+			init_inline();
+			try {
+				assign(x.begin(), x.end());
+			}
+			catch (...) {
+				release();
+				throw;
+			}
+		}
+
+		// Destructor
+		~small_vector() { release(); }
+
+		// Assignment operator
+		small_vector& operator=(const small_vector& x) {
+			if (this != &x)
+				assign(x.begin(), x.end());
+			return *this;
+		}
+
+		// Iterators:
+		iterator 				begin() { return _start; }
+		const_iterator	begin() const { return _start; }
+		iterator				end() { return _finish; }
+		const_iterator	end() const { return _finish; }
+		reverse_iterator				rbegin() { return reverse_iterator(end()); }
+		const_reverse_iterator	rbegin() const { return const_reverse_iterator(end()); }
+		reverse_iterator				rend() { return reverse_iterator(begin()); }
+		const_reverse_iterator	rend() const { return const_reverse_iterator(begin()); }
+		// Capacity:
+		size_type	size() const { return size_type(_finish - _start); }
+		size_type	max_size() const { return _alloc.max_size(); }
+		void			resize(size_type n, value_type val = value_type()) {
+			if (n < size())
+				erase(_start + n, _finish);
+			else if (n > size())
+				insert(_finish, n - size(), val);
+		}
+		// ft extension, as ft::vector::resize_uninitialized: the new elements of a trivially copyable type
+		// are left uninitialized, the others are value-initialized as by resize(n).
+		void			resize_uninitialized(size_type n) {
+			if (!ft::is_trivially_copyable<value_type>::value || n <= size())
+				resize(n);
+			else {
+				if (n > capacity())
+					reallocate(next_capacity(n));
+				_finish = _start + n;
+			}
+		}
+		size_type	capacity() const { return size_type(_end_of_storage - _start); }
+		bool			empty() const { return _start == _finish;}
+		void			reserve(size_type n) {
+			if (n > max_size())
+				throw std::length_error("Small_vector reserve error");
+			else if (n > capacity())
+				reallocate(n);
+		}
+		// Element access:
+		reference 			operator[](size_type n) { return *(_start + n); }
+		const_reference	operator[](size_type n) const { return *(_start + n); }
+		reference				at(size_type n) {
+			if (n >= size())
+				throw std::out_of_range("Small_vector at error");
+			return (*this)[n];
+		}
+		const_reference	at(size_type n) const {
+			if (n >= size())
+				throw std::out_of_range("Small_vector at error");
+			return (*this)[n];
+		}
+		reference				front() { return *_start; }
+		const_reference	front() const { return *_start; }
+		reference				back() { return *(_finish - 1); }
+		const_reference	back() const { return *(_finish - 1); }
+		// Modifiers:
+		template <class InputIterator>
+		void assign(InputIterator first, InputIterator last,
+								typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr) {
+			clear();
+			if (ft::is_forward_iterator<InputIterator>::value) {
+				size_type n = ft::distance(first, last);
+				if (n > capacity())
+					reallocate(next_capacity(n));
+				_finish = ft::detail::construct_range(_alloc, first, last, _start);
+			}
+			else {
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+		}	// range
+		void assign(size_type n, const value_type& val) {
+			value_type copy(val);	// val may be an element of this vector
+			clear();
+			if (n > capacity())
+				reallocate(next_capacity(n));
+			_finish = ft::detail::construct_fill(_alloc, _start, n, copy);
+		}	// fill
+		void push_back(const value_type& val) {
+			if (_finish == _end_of_storage) {
+				value_type copy(val);
+				reallocate(next_capacity(size() + 1));
+				_alloc.construct(_finish, copy);
+			}
+			else
+				_alloc.construct(_finish, val);
+			++_finish;
+		}
+#if __cplusplus >= 201103L
+		template <class... Args>
+		void			emplace_back(Args&&... args) {
+			emplace_at(_finish, [&](void* p) { ::new (p) value_type(std::forward<Args>(args)...); });
+		}
+		template <class... Args>
+		iterator	emplace(iterator position, Args&&... args) {
+			return emplace_at(position.base(), [&](void* p) { ::new (p) value_type(std::forward<Args>(args)...); });
+		}
+#else
+		// Up to five constructor arguments, taken by const reference.
+		void			emplace_back() { emplace_at(_finish, ft::emplace_args0<value_type>()); }
+		template <class A1>
+		void			emplace_back(const A1& a1) { emplace_at(_finish, ft::emplace_args1<value_type, A1>(a1)); }
+		template <class A1, class A2>
+		void			emplace_back(const A1& a1, const A2& a2) {
+			emplace_at(_finish, ft::emplace_args2<value_type, A1, A2>(a1, a2));
+		}
+		template <class A1, class A2, class A3>
+		void			emplace_back(const A1& a1, const A2& a2, const A3& a3) {
+			emplace_at(_finish, ft::emplace_args3<value_type, A1, A2, A3>(a1, a2, a3));
+		}
+		template <class A1, class A2, class A3, class A4>
+		void			emplace_back(const A1& a1, const A2& a2, const A3& a3, const A4& a4) {
+			emplace_at(_finish, ft::emplace_args4<value_type, A1, A2, A3, A4>(a1, a2, a3, a4));
+		}
+		template <class A1, class A2, class A3, class A4, class A5>
+		void			emplace_back(const A1& a1, const A2& a2, const A3& a3, const A4& a4, const A5& a5) {
+			emplace_at(_finish, ft::emplace_args5<value_type, A1, A2, A3, A4, A5>(a1, a2, a3, a4, a5));
+		}
+		iterator	emplace(iterator position) { return emplace_at(position.base(), ft::emplace_args0<value_type>()); }
+		template <class A1>
+		iterator	emplace(iterator position, const A1& a1) {
+			return emplace_at(position.base(), ft::emplace_args1<value_type, A1>(a1));
+		}
+		template <class A1, class A2>
+		iterator	emplace(iterator position, const A1& a1, const A2& a2) {
+			return emplace_at(position.base(), ft::emplace_args2<value_type, A1, A2>(a1, a2));
+		}
+		template <class A1, class A2, class A3>
+		iterator	emplace(iterator position, const A1& a1, const A2& a2, const A3& a3) {
+			return emplace_at(position.base(), ft::emplace_args3<value_type, A1, A2, A3>(a1, a2, a3));
+		}
+		template <class A1, class A2, class A3, class A4>
+		iterator	emplace(iterator position, const A1& a1, const A2& a2, const A3& a3, const A4& a4) {
+			return emplace_at(position.base(), ft::emplace_args4<value_type, A1, A2, A3, A4>(a1, a2, a3, a4));
+		}
+		template <class A1, class A2, class A3, class A4, class A5>
+		iterator	emplace(iterator position, const A1& a1, const A2& a2, const A3& a3, const A4& a4, const A5& a5) {
+			return emplace_at(position.base(), ft::emplace_args5<value_type, A1, A2, A3, A4, A5>(a1, a2, a3, a4, a5));
+		}
+#endif
+		void pop_back() { _alloc.destroy(--_finish); }
+		iterator	insert(iterator position, const value_type& val) {
+			size_type offset = position.base() - _start;
+			insert(position, 1, val);
+			return _start + offset;
+		}	// single element
+		void			insert(iterator position, size_type n, const value_type& val) {
+			if (n == 0)
+				return;
+			value_type copy(val);
+			pointer pos = reserve_gap(position.base(), n);
+			if (ft::is_relocatable<value_type>::value) {
+				_finish = ft::detail::open_gap(pos, _finish, n);
+				try {
+					ft::detail::construct_fill(_alloc, pos, n, copy);
+				}
+				catch (...) {
+					_finish = ft::detail::close_gap(pos, _finish, n);
+					throw;
+				}
+				return;
+			}
+			pointer old_finish = _finish;
+			size_type after = old_finish - pos;
+			if (after > n) {
+				_finish = ft::detail::transfer_range(_alloc, old_finish - n, old_finish, old_finish);
+				ft::detail::shift_right(pos, old_finish - n, old_finish);
+				std::fill(pos, pos + n, copy);
+			}
+			else {
+				_finish = ft::detail::construct_fill(_alloc, old_finish, n - after, copy);
+				_finish = ft::detail::transfer_range(_alloc, pos, old_finish, _finish);
+				std::fill(pos, old_finish, copy);
+			}
+		}	// fill
+		template <class InputIterator>
+		void			insert(iterator position, InputIterator first, InputIterator last,
+										typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr) {
+			if (!ft::is_forward_iterator<InputIterator>::value) {
+				small_vector tmp(first, last, _alloc);
+				insert(position, tmp.begin(), tmp.end());
+				return;
+			}
+			size_type n = ft::distance(first, last);
+			if (n == 0)
+				return;
+			pointer pos = reserve_gap(position.base(), n);
+			if (ft::is_relocatable<value_type>::value) {
+				_finish = ft::detail::open_gap(pos, _finish, n);
+				try {
+					ft::detail::construct_range(_alloc, first, last, pos);
+				}
+				catch (...) {
+					_finish = ft::detail::close_gap(pos, _finish, n);
+					throw;
+				}
+				return;
+			}
+			pointer old_finish = _finish;
+			size_type after = old_finish - pos;
+			if (after > n) {
+				_finish = ft::detail::transfer_range(_alloc, old_finish - n, old_finish, old_finish);
+				ft::detail::shift_right(pos, old_finish - n, old_finish);
+				std::copy(first, last, pos);
+			}
+			else {
+				InputIterator mid = first;
+				ft::advance(mid, after);
+				_finish = ft::detail::construct_range(_alloc, mid, last, old_finish);
+				_finish = ft::detail::transfer_range(_alloc, pos, old_finish, _finish);
+				std::copy(first, mid, pos);
+			}
+		}	// range
+		iterator erase(iterator position) { return erase(position, position + 1); }
+		iterator erase(iterator first, iterator last) {
+			if (first == last)
+				return first;
+			if (ft::is_relocatable<value_type>::value) {
+				ft::detail::destroy_range(_alloc, first.base(), last.base());
+				_finish = ft::detail::close_gap(first.base(), _finish, last - first);
+			}
+			else {
+				pointer finish = ft::detail::shift_left(last.base(), _finish, first.base());
+				ft::detail::destroy_range(_alloc, finish, _finish);
+				_finish = finish;
+			}
+			return first;
+		}	// range
+		void swap(small_vector& x) {
+			if (this == &x)
+				return;
+			if (is_inline() || x.is_inline()) {
+				small_vector tmp(*this);
+				*this = x;
+				x = tmp;
+				return;
+			}
+			std::swap(_alloc, x._alloc);
+			std::swap(_start, x._start);
+			std::swap(_finish, x._finish);
+			std::swap(_end_of_storage, x._end_of_storage);
+		}
+		void clear() { while (_start != _finish) _alloc.destroy(--_finish); }
+		// Allocator:
+		allocator_type get_allocator() const { return _alloc; }
+
+	private:
+		pointer	inline_begin() { return reinterpret_cast<pointer>(_inline.bytes); }
+		bool		is_inline() const { return _start == reinterpret_cast<const_pointer>(_inline.bytes); }
+
+		void init_inline() {
+			_start = inline_begin();
+			_finish = _start;
+			_end_of_storage = _start + N;
+		}
+
+		// Destroys the elements and gives a heap buffer back to the allocator.
+		void release() {
+			clear();
+			if (!is_inline())
+				_alloc.deallocate(_start, capacity());
+		}
+
+		// Capacity for required elements, doubled like ft::vector and at most max_size().
+		size_type next_capacity(size_type required) const {
+			if (required > max_size())
+				throw std::length_error("Small_vector length error");
+			size_type res = ft::double_growth::next_capacity(capacity(), required);
+			if (res < required || res > max_size())
+				res = max_size();
+			return res;
+		}
+
+		// Moves the elements to a heap buffer of new_cap elements.
+		void reallocate(size_type new_cap) {
+			pointer start = _alloc.allocate(new_cap);
+			pointer finish;
+			if (ft::is_relocatable<value_type>::value)
+				finish = ft::detail::relocate_range(_start, _finish, start);
+			else {
+				try {
+					finish = ft::detail::transfer_range(_alloc, _start, _finish, start);
+				}
+				catch (...) {
+					_alloc.deallocate(start, new_cap);
+					throw;
+				}
+				ft::detail::destroy_range(_alloc, _start, _finish);
+			}
+			if (!is_inline())
+				_alloc.deallocate(_start, capacity());
+			_start = start;
+			_finish = finish;
+			_end_of_storage = start + new_cap;
+		}
+
+		// Makes room for n more elements and returns where position is afterwards.
+		pointer reserve_gap(pointer position, size_type n) {
+			size_type offset = position - _start;
+			if (size_type(_end_of_storage - _finish) < n)
+				reallocate(next_capacity(size() + n));
+			return _start + offset;
+		}
+
+		// Builds one element at position with construct(void*), no temporary is copied.
+		// As in ft::vector, the element is built before anything moves, since the arguments
+		// may refer to elements of this small_vector.
+		template <class Construct>
+		pointer emplace_at(pointer position, const Construct& construct) {
+			size_type offset = position - _start;
+			if (_finish == _end_of_storage) {
+				size_type new_cap = next_capacity(size() + 1);
+				pointer start = _alloc.allocate(new_cap);
+				pointer gap = start + offset;
+				try {
+					construct(static_cast<void*>(gap));
+				}
+				catch (...) {
+					_alloc.deallocate(start, new_cap);
+					throw;
+				}
+				pointer finish = ft::detail::relocate_around(_alloc, _start, position, _finish, start, new_cap, gap, 1);
+				if (!is_inline())
+					_alloc.deallocate(_start, capacity());
+				_start = start;
+				_finish = finish;
+				_end_of_storage = start + new_cap;
+			}
+			else if (position == _finish) {
+				construct(static_cast<void*>(_finish));
+				++_finish;
+			}
+			else if (ft::is_relocatable<value_type>::value) {
+				char bytes[sizeof(value_type)];
+				construct(static_cast<void*>(_finish));
+				std::memcpy(bytes, static_cast<const void*>(_finish), sizeof(value_type));
+				_finish = ft::detail::open_gap(position, _finish, 1);
+				std::memcpy(static_cast<void*>(position), bytes, sizeof(value_type));
+			}
+			else {
+				construct(static_cast<void*>(_finish));
+				++_finish;
+				std::rotate(position, _finish - 1, _finish);
+			}
+			return _start + offset;
+		}
+
+		/**
+		 * @brief Member variables
+		 */
+		union inline_storage {
+			char				bytes[sizeof(T) * (N ? N : 1)];
+			long double	align_long_double;
+			void*				align_pointer;
+		};
+
+		allocator_type	_alloc;
+		pointer					_start;
+		pointer					_finish;
+		pointer					_end_of_storage;
+		inline_storage	_inline;
+	};
+
+	template <class T, size_t N, class Alloc>
+	const typename small_vector<T, N, Alloc>::size_type small_vector<T, N, Alloc>::inline_capacity;
+
+	// Relational operators
+	template <class T, size_t N, class Alloc>
+	inline bool operator==(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal_contiguous(lhs.begin().base(), rhs.begin().base(), lhs.size());
+	}
+
+	template <class T, size_t N, class Alloc>
+	inline bool operator!=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) { return !(lhs == rhs); }
+
+	template <class T, size_t N, class Alloc>
+	inline bool operator<(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return ft::less_contiguous(lhs.begin().base(), lhs.size(), rhs.begin().base(), rhs.size());
+	}
+
+	template <class T, size_t N, class Alloc>
+	inline bool operator<=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) { return !(rhs < lhs); }
+
+	template <class T, size_t N, class Alloc>
+	inline bool operator>(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) { return rhs < lhs; }
+
+	template <class T, size_t N, class Alloc>
+	inline bool operator>=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) { return !(lhs < rhs); }
+
+	// swap
+	template <class T, size_t N, class Alloc>
+	inline void swap(small_vector<T, N, Alloc>& x, small_vector<T, N, Alloc>& y) { x.swap(y); }
+} // namespace ft
+
+#endif
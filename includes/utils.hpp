@@ -1,6 +1,13 @@
 #ifndef UTILS_HPP
 #define UTILS_HPP
 
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <string>
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif
 #include "Iterators.hpp"
 
 namespace ft
@@ -125,6 +132,26 @@ namespace ft
 	template <typename T>
 	struct is_integral : public is_integral_helper<typename remove_cv<T>::type> {};
 
+	/**
+	 * @brief is_arithmetic
+	 * Identifies whether T is an integral or a floating point type.
+	 * 
+	 * @tparam T	type
+	 */
+	template <typename T>
+	struct is_floating_point_helper : false_type {};
+	template <>
+	struct is_floating_point_helper<float> : true_type {};
+	template <>
+	struct is_floating_point_helper<double> : true_type {};
+	template <>
+	struct is_floating_point_helper<long double> : true_type {};
+
+	template <typename T>
+	struct is_arithmetic {
+		enum _value { value = is_integral<T>::value || is_floating_point_helper<typename remove_cv<T>::type>::value };
+	};
+
 	/**
 	 * @brief equal
 	 * Test whether the elements in two ranges are equal.
@@ -209,6 +236,94 @@ namespace ft
 		return (first2 != last2);
 	}	// custom
 
+	/**
+	 * @brief first_mismatch
+	 * Offset of the first byte that differs between two buffers of n bytes, n if they are equal.
+	 * SSE2 compares 64 bytes per step, then finds the byte in the 16 that differ.
+	 */
+	inline size_t first_mismatch(const unsigned char* lhs, const unsigned char* rhs, size_t n) {
+		size_t i = 0;
+#ifdef __SSE2__
+		for (; i + 64 <= n; i += 64) {
+			__m128i eq = _mm_and_si128(
+				_mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)),
+											 _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i))),
+							  _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i + 16)),
+											 _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i + 16)))),
+				_mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i + 32)),
+											 _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i + 32))),
+							  _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i + 48)),
+											 _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i + 48)))));
+			if (_mm_movemask_epi8(eq) != 0xFFFF)
+				break;
+		}
+		for (; i + 16 <= n; i += 16) {
+			int ne = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)),
+													  _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i)))) ^ 0xFFFF;
+			if (ne != 0)
+				return i + __builtin_ctz(ne);
+		}
+#else
+		for (; i + 64 <= n && std::memcmp(lhs + i, rhs + i, 64) == 0; i += 64)
+			;
+#endif
+		while (i < n && lhs[i] == rhs[i])
+			++i;
+		return i;
+	}
+
+	/**
+	 * @brief equal_contiguous / less_contiguous
+	 * equal and lexicographical_compare on arrays, used by the relational operators of vector.
+	 * Integral types have no padding and one representation per value, so they compare as bytes:
+	 * equality is a memcmp, ordering finds the first byte that differs and compares the element holding it,
+	 * which keeps signed and multibyte orderings. A byte-sized unsigned type orders like memcmp.
+	 * Other types, floating point included (-0.0 == 0.0, NaN != NaN), go through the generic algorithms.
+	 * 
+	 * @param lhs		first array of n (lhs_n) elements
+	 * @param rhs		second array of n (rhs_n) elements
+	 */
+	template <typename T>
+	bool equal_contiguous(const T* lhs, const T* rhs, size_t n, ft::true_type) {
+		return n == 0 || std::memcmp(lhs, rhs, n * sizeof(T)) == 0;
+	}
+
+	template <typename T>
+	bool equal_contiguous(const T* lhs, const T* rhs, size_t n, ft::false_type) {
+		return ft::equal(lhs, lhs + n, rhs);
+	}
+
+	template <typename T>
+	bool equal_contiguous(const T* lhs, const T* rhs, size_t n) {
+		return equal_contiguous(lhs, rhs, n, ft::is_integral<T>());
+	}
+
+	template <typename T>
+	bool less_contiguous(const T* lhs, size_t lhs_n, const T* rhs, size_t rhs_n, ft::true_type) {
+		size_t n = lhs_n < rhs_n ? lhs_n : rhs_n;
+		if (n == 0)
+			return lhs_n < rhs_n;
+		if (sizeof(T) == 1 && T(-1) > T(0)) {
+			int res = std::memcmp(lhs, rhs, n);
+			return res < 0 || (res == 0 && lhs_n < rhs_n);
+		}
+		size_t i = first_mismatch(reinterpret_cast<const unsigned char*>(lhs),
+								  reinterpret_cast<const unsigned char*>(rhs), n * sizeof(T)) / sizeof(T);
+		if (i == n)
+			return lhs_n < rhs_n;
+		return lhs[i] < rhs[i];
+	}
+
+	template <typename T>
+	bool less_contiguous(const T* lhs, size_t lhs_n, const T* rhs, size_t rhs_n, ft::false_type) {
+		return ft::lexicographical_compare(lhs, lhs + lhs_n, rhs, rhs + rhs_n);
+	}
+
+	template <typename T>
+	bool less_contiguous(const T* lhs, size_t lhs_n, const T* rhs, size_t rhs_n) {
+		return less_contiguous(lhs, lhs_n, rhs, rhs_n, ft::is_integral<T>());
+	}
+
 	/**
 	 * @brief binary_function
 	 * Binary function object base class.
@@ -230,11 +345,295 @@ namespace ft
 	 * 
 	 * @tparam T	Type of the arguments to compare by the functional call.
 	 */
-	template <class T>
+	template <class T = void>
 	struct less : binary_function<T, T, bool> {
 		bool operator()(const T& x, const T& y) const { return x < y; }
 	};
 
+	/**
+	 * @brief less<void>
+	 * Transparent less-than comparison, the argument types are deduced.
+	 * A map<std::string, T, ft::less<> > can be searched with a const char* key
+	 * without building a std::string.
+	 */
+	template <>
+	struct less<void> {
+		typedef void is_transparent;
+
+		template <class T, class U>
+		bool operator()(const T& x, const U& y) const { return x < y; }
+	};
+
+	/**
+	 * @brief is_transparent
+	 * Identifies whether the comparator Compare defines is_transparent,
+	 * which means that it accepts keys of any comparable type.
+	 * 
+	 * @tparam Compare	comparator type
+	 * @tparam K				Unused, lets a member template depend on its own key type for SFINAE.
+	 */
+	template <typename Compare, typename K = void>
+	struct is_transparent {
+	private :
+		typedef char	yes;
+		typedef long	no;
+
+		template <typename C>
+		static yes test(typename C::is_transparent*);
+		template <typename C>
+		static no test(...);
+
+	public :
+		enum _value { value = sizeof(test<Compare>(0)) == sizeof(yes) };
+	};
+
+	/**
+	 * @brief three_way
+	 * Three-way comparison policy of the trees. compare(comp, a, b) is negative, zero or positive
+	 * when a goes before, is equivalent to or goes after b, at the cost of a single comparison.
+	 * value is false for a plain less-than comparator: the trees then call it once per level
+	 * and check the equivalence once at the end instead.
+	 * 
+	 * A comparator opts in with typedef void is_three_way and a member int compare(a, b) const,
+	 * ft::less on arithmetic types and on std::string is adapted automatically.
+	 * 
+	 * @tparam Compare	comparator type
+	 * @tparam Enable		Selects the specialization.
+	 */
+	template <class Compare, class Enable = void>
+	struct three_way {
+		enum _value { value = false };
+
+		template <class A, class B>
+		static int compare(const Compare& comp, const A& a, const B& b) {
+			if (comp(a, b))
+				return -1;
+			return comp(b, a) ? 1 : 0;
+		}
+	};
+
+	template <class Compare>
+	struct three_way<Compare, typename Compare::is_three_way> {
+		enum _value { value = true };
+
+		template <class A, class B>
+		static int compare(const Compare& comp, const A& a, const B& b) { return comp.compare(a, b); }
+	};
+
+	template <class T>
+	struct three_way<ft::less<T>, typename ft::enable_if<ft::is_arithmetic<T>::value>::type> {
+		enum _value { value = true };
+
+		static int compare(const ft::less<T>&, const T& a, const T& b) { return (a < b) ? -1 : (b < a); }
+	};
+
+	template <class Char, class Traits, class Alloc>
+	struct three_way<ft::less<std::basic_string<Char, Traits, Alloc> >, void> {
+		enum _value { value = true };
+
+		static int compare(const ft::less<std::basic_string<Char, Traits, Alloc> >&,
+							const std::basic_string<Char, Traits, Alloc>& a, const std::basic_string<Char, Traits, Alloc>& b) {
+			return a.compare(b);
+		}
+	};
+
+	/**
+	 * @brief has_trivial_destructor
+	 * True when destroying a T does nothing, so its storage can be freed without calling ~T().
+	 * g++ and clang provide the intrinsic even in C++98, other compilers only trust integral types.
+	 * 
+	 * @tparam T	type
+	 */
+	template <typename T>
+	struct has_trivial_destructor {
+#if defined(__clang__)
+		enum _value { value = __is_trivially_destructible(T) };
+#elif defined(__GNUC__)
+		enum _value { value = __has_trivial_destructor(T) };
+#else
+		enum _value { value = is_arithmetic<T>::value };
+#endif
+	};
+
+	/**
+	 * @brief is_trivially_copyable
+	 * True when a T can be copied byte by byte and needs no destructor call.
+	 * Uses the compiler intrinsic when there is one, otherwise only arithmetic types qualify.
+	 * 
+	 * @tparam T	type
+	 */
+	template <typename T>
+	struct is_trivially_copyable {
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+		enum _value { value = __is_trivially_copyable(T) };
+#elif defined(__GNUC__)
+		enum _value { value = __has_trivial_copy(T) && __has_trivial_destructor(T) };
+#else
+		enum _value { value = is_arithmetic<T>::value };
+#endif
+	};
+
+	/**
+	 * @brief is_relocatable
+	 * True when moving a T to another address can be done with memcpy,
+	 * leaving the source as raw storage that is freed without calling ~T().
+	 * Defaults to is_trivially_copyable, specialize it for types that hold no pointer to themselves.
+	 * 
+	 * @tparam T	type
+	 */
+	template <typename T>
+	struct is_relocatable {
+		enum _value { value = is_trivially_copyable<typename remove_cv<T>::type>::value };
+	};
+
+	/**
+	 * @brief fill_trivial
+	 * Fills the raw storage at dest with n byte copies of val, for trivially copyable T.
+	 * A value made of one repeated byte (zero, -1, false, ...) is a memset,
+	 * any other value is written into a block of at most 4KB that is then copied over the rest,
+	 * so the bulk of the work is done by memcpy with the widest stores the C library has.
+	 * 
+	 * @return	dest + n
+	 */
+	template <typename T>
+	T* fill_trivial(T* dest, size_t n, const T& val) {
+		const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&val);
+		size_t i = 1;
+		while (i < sizeof(T) && bytes[i] == bytes[0])
+			++i;
+		if (i == sizeof(T)) {
+			if (n > 0)
+				std::memset(static_cast<void*>(dest), bytes[0], n * sizeof(T));
+			return dest + n;
+		}
+		size_t block = 4096 / sizeof(T) + 1;
+		if (block > n)
+			block = n;
+		for (i = 0; i < block; ++i)
+			std::memcpy(static_cast<void*>(dest + i), bytes, sizeof(T));
+		for (; i < n; i += block) {
+			if (block > n - i)
+				block = n - i;
+			std::memcpy(static_cast<void*>(dest + i), dest, block * sizeof(T));
+		}
+		return dest + n;
+	}
+
+	/**
+	 * @brief emplace_args0 ~ emplace_args5
+	 * Constructor arguments of a C++98 emplace call, kept by reference.
+	 * operator() builds a T from them in the raw storage at p.
+	 * C++11 builds forward the arguments through a lambda instead.
+	 * 
+	 * @tparam T				type to construct
+	 * @tparam A1 ~ A5	argument types
+	 */
+	template <class T>
+	struct emplace_args0 {
+		void operator()(void* p) const { ::new (p) T(); }
+	};
+
+	template <class T, class A1>
+	struct emplace_args1 {
+		const A1&	_a1;
+		explicit emplace_args1(const A1& a1) : _a1(a1) {}
+		void operator()(void* p) const { ::new (p) T(_a1); }
+	};
+
+	template <class T, class A1, class A2>
+	struct emplace_args2 {
+		const A1&	_a1;
+		const A2&	_a2;
+		emplace_args2(const A1& a1, const A2& a2) : _a1(a1), _a2(a2) {}
+		void operator()(void* p) const { ::new (p) T(_a1, _a2); }
+	};
+
+	template <class T, class A1, class A2, class A3>
+	struct emplace_args3 {
+		const A1&	_a1;
+		const A2&	_a2;
+		const A3&	_a3;
+		emplace_args3(const A1& a1, const A2& a2, const A3& a3) : _a1(a1), _a2(a2), _a3(a3) {}
+		void operator()(void* p) const { ::new (p) T(_a1, _a2, _a3); }
+	};
+
+	template <class T, class A1, class A2, class A3, class A4>
+	struct emplace_args4 {
+		const A1&	_a1;
+		const A2&	_a2;
+		const A3&	_a3;
+		const A4&	_a4;
+		emplace_args4(const A1& a1, const A2& a2, const A3& a3, const A4& a4) : _a1(a1), _a2(a2), _a3(a3), _a4(a4) {}
+		void operator()(void* p) const { ::new (p) T(_a1, _a2, _a3, _a4); }
+	};
+
+	template <class T, class A1, class A2, class A3, class A4, class A5>
+	struct emplace_args5 {
+		const A1&	_a1;
+		const A2&	_a2;
+		const A3&	_a3;
+		const A4&	_a4;
+		const A5&	_a5;
+		emplace_args5(const A1& a1, const A2& a2, const A3& a3, const A4& a4, const A5& a5)
+		: _a1(a1), _a2(a2), _a3(a3), _a4(a4), _a5(a5) {}
+		void operator()(void* p) const { ::new (p) T(_a1, _a2, _a3, _a4, _a5); }
+	};
+
+	/**
+	 * @brief is_swap_relocatable
+	 * True when a T owns its contents through pointers and its swap is O(1) and does not throw.
+	 * Such an element moves to new storage by default constructing the target and swapping,
+	 * instead of copying all its contents. ft containers specialize it next to their definition.
+	 * 
+	 * @tparam T	type
+	 */
+	template <typename T>
+	struct is_swap_relocatable { enum _value { value = false }; };
+
+	template <class Char, class Traits, class Alloc>
+	struct is_swap_relocatable<std::basic_string<Char, Traits, Alloc> > { enum _value { value = true }; };
+
+	/**
+	 * @brief reallocate_in_place
+	 * Lets vector grow its buffer through the allocator without copying the elements.
+	 * Returns null for any other allocator, vector then allocates a new buffer and copies.
+	 * ft::mmap_allocator specializes it next to its definition.
+	 * 
+	 * @tparam Alloc	Type of the vector allocator
+	 */
+	template <class Alloc>
+	struct reallocate_in_place {
+		static typename Alloc::pointer reallocate(Alloc&, typename Alloc::pointer, size_t, size_t) { return ft_nullptr; }
+	};
+
+	/**
+	 * @brief select_first / identity
+	 * Key extraction policies of the trees.
+	 * A map stores pair<const Key, T> and its key is first,
+	 * a set stores the key itself.
+	 * 
+	 * @tparam Pair	value_type of the map
+	 * @tparam T		value_type of the set
+	 */
+	template <class Pair>
+	struct select_first {
+		const typename Pair::first_type& operator()(const Pair& x) const { return x.first; }
+	};
+
+	template <class T>
+	struct identity {
+		const T& operator()(const T& x) const { return x; }
+	};
+
+	/**
+	 * @brief sorted_unique_t
+	 * Tag of the map / set constructor and insert that take a range
+	 * already sorted by key_compare without equivalent keys.
+	 * The tree is then built in O(n) without comparing the keys.
+	 */
+	struct sorted_unique_t {};
+	static const sorted_unique_t sorted_unique = sorted_unique_t();
+
 	/**
 	 * @brief pair
 	 * 
@@ -314,9 +713,84 @@ namespace ft
 	template <class T1, class T2>
 	ft::pair<T1, T2> make_pair(T1 x, T2 y) { return ft::pair<T1, T2>(x, y); }
 
+	/**
+	 * @brief distance_impl / advance_impl
+	 * Overloads selected by iterator_category. Random-access iterators jump in O(1),
+	 * the others step one by one. The std tags are handled too, so std iterators passed
+	 * to ft containers take the same paths.
+	 */
+	template <typename InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type distance_impl(InputIterator first, InputIterator last, ft::input_iterator_tag) {
+		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
+		for (; first != last; ++first)
+			++n;
+		return n;
+	}
+	template <typename InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type distance_impl(InputIterator first, InputIterator last, std::input_iterator_tag) {
+		return ft::distance_impl(first, last, ft::input_iterator_tag());
+	}
+	template <typename RandomAccessIterator>
+	typename ft::iterator_traits<RandomAccessIterator>::difference_type distance_impl(RandomAccessIterator first, RandomAccessIterator last, ft::random_access_iterator_tag) {
+		return last - first;
+	}
+	template <typename RandomAccessIterator>
+	typename ft::iterator_traits<RandomAccessIterator>::difference_type distance_impl(RandomAccessIterator first, RandomAccessIterator last, std::random_access_iterator_tag) {
+		return last - first;
+	}
+
+	template <typename InputIterator, typename Distance>
+	void advance_impl(InputIterator& it, Distance n, ft::input_iterator_tag) {
+		for (; n > 0; --n)
+			++it;
+	}
+	template <typename InputIterator, typename Distance>
+	void advance_impl(InputIterator& it, Distance n, std::input_iterator_tag) {
+		ft::advance_impl(it, n, ft::input_iterator_tag());
+	}
+	template <typename BidirectionalIterator, typename Distance>
+	void advance_impl(BidirectionalIterator& it, Distance n, ft::bidirectional_iterator_tag) {
+		for (; n > 0; --n)
+			++it;
+		for (; n < 0; ++n)
+			--it;
+	}
+	template <typename BidirectionalIterator, typename Distance>
+	void advance_impl(BidirectionalIterator& it, Distance n, std::bidirectional_iterator_tag) {
+		ft::advance_impl(it, n, ft::bidirectional_iterator_tag());
+	}
+	template <typename RandomAccessIterator, typename Distance>
+	void advance_impl(RandomAccessIterator& it, Distance n, ft::random_access_iterator_tag) {
+		it += n;
+	}
+	template <typename RandomAccessIterator, typename Distance>
+	void advance_impl(RandomAccessIterator& it, Distance n, std::random_access_iterator_tag) {
+		it += n;
+	}
+
+	/**
+	 * @brief is_forward_iterator
+	 * True when the iterator_category is forward or better (ft or std tags),
+	 * so the range can be read twice, once to count and once to copy.
+	 * Input iterators such as std::istream_iterator are single-pass.
+	 * 
+	 * @tparam Iterator	iterator type
+	 */
+	template <typename Iterator>
+	struct is_forward_iterator {
+	private:
+		static char test(ft::forward_iterator_tag);
+		static char test(std::forward_iterator_tag);
+		static long test(...);
+
+	public:
+		enum _value { value = sizeof(test(typename ft::iterator_traits<Iterator>::iterator_category())) == sizeof(char) };
+	};
+
 	/**
 	 * @brief distance
 	 * User-defined function for finding the distance between two iterators.
+	 * O(1) for random-access iterators, linear otherwise.
 	 * 
 	 * @tparam InputIterator		iterator type
 	 * @param first		initial position of the iterator
@@ -325,10 +799,22 @@ namespace ft
 	 */
 	template <typename InputIterator>
 	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last) {
-		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
-		while (first++ != last)
-			n++;
-		return n;
+		return ft::distance_impl(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+	}
+
+	/**
+	 * @brief advance
+	 * Moves it by n positions, backwards when n is negative (bidirectional iterators only).
+	 * O(1) for random-access iterators, linear otherwise.
+	 * 
+	 * @tparam InputIterator	iterator type
+	 * @tparam Distance				integral type of n
+	 * @param it							iterator to move
+	 * @param n								number of positions
+	 */
+	template <typename InputIterator, typename Distance>
+	void advance(InputIterator& it, Distance n) {
+		ft::advance_impl(it, n, typename ft::iterator_traits<InputIterator>::iterator_category());
 	}
 
 	template <bool flag, class IsTrue, class IsFalse>
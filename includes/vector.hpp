@@ -1,19 +1,48 @@
 #ifndef VECTOR_HPP
 #define VECTOR_HPP
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+#include "VectorBuffer.hpp"
 #include "VectorIterator.hpp"
 
 namespace ft
 {
+	/**
+	 * @brief double_growth / half_growth / exact_growth
+	 * Growth policies of vector, the capacity to allocate when required elements do not fit.
+	 * Geometric growth keeps push_back and insert at the end amortized O(1),
+	 * exact_growth allocates only what is needed.
+	 */
+	struct double_growth {
+		static size_t next_capacity(size_t capacity, size_t required) {
+			return (capacity * 2 > required) ? capacity * 2 : required;
+		}
+	};
+
+	struct half_growth {
+		static size_t next_capacity(size_t capacity, size_t required) {
+			return (capacity + capacity / 2 > required) ? capacity + capacity / 2 : required;
+		}
+	};
+
+	struct exact_growth {
+		static size_t next_capacity(size_t, size_t required) { return required; }
+	};
+
 	/**
 	 * @brief vector class
 	 * 
 	 * @tparam T			Type of the elements.(value_type)
 	 * @tparam Alloc	Type of the allocator object used to define the storage allocation model.(allocator_type)
+	 * @tparam Growth	Growth policy used when the capacity is exceeded.(growth_policy)
 	 */
-	template < class T, class Alloc = std::allocator<T> >
+	template < class T, class Alloc = std::allocator<T>, class Growth = ft::double_growth >
 	class vector {
 	public:
 		/**
@@ -31,6 +60,7 @@ namespace ft
 		typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
 		typedef typename allocator_type::difference_type	difference_type;
 		typedef typename allocator_type::size_type				size_type;
+		typedef Growth																		growth_policy;
 
 		/**
 		 * @brief Member functions
@@ -46,8 +76,13 @@ namespace ft
 			_start = _alloc.allocate(n);
 			_finish = _start;
 			_end_of_storage = _start + n;
-			while (n--)
-				_alloc.construct(_finish++, val);
+			try {
+				_finish = ft::detail::construct_fill(_alloc, _start, n, val);
+			}
+			catch (...) {
+				_alloc.deallocate(_start, n);
+				throw;
+			}
 		}
 
 		// Range constructor
@@ -56,12 +91,29 @@ namespace ft
 					const allocator_type& alloc = allocator_type(),
 					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr)
 		: _alloc(alloc), _start(ft_nullptr), _finish(ft_nullptr), _end_of_storage(ft_nullptr) {
-			difference_type n = ft::distance(first, last);
-			_start = _alloc.allocate(n);
-			_finish = _start;
-			_end_of_storage = _start + n;
-			while (n--)
-				_alloc.construct(_finish++, *first++);
+			if (ft::is_forward_iterator<InputIterator>::value) {
+				size_type n = ft::distance(first, last);
+				_start = _alloc.allocate(n);
+				_finish = _start;
+				_end_of_storage = _start + n;
+				try {
+					_finish = ft::detail::construct_range(_alloc, first, last, _start);
+				}
+				catch (...) {
+					_alloc.deallocate(_start, n);
+					throw;
+				}
+			}
+			else {
+				try {
+					append_input(first, last);
+				}
+				catch (...) {
+					clear();
+					_alloc.deallocate(_start, capacity());
+					throw;
+				}
+			}
 		}
 
 		// Copy constructor
@@ -83,11 +135,30 @@ namespace ft
 		}
 
 		// Assignment operator
+		// Reuses the buffer when x fits: the common elements are assigned,
+		// only the size difference is constructed or destroyed.
 		vector& operator=(const vector& x) {
-			if (this != &x) {
+			if (this == &x)
+				return *this;
+			size_type n = x.size();
+			if (n > capacity()) {
 				clear();
 				assign(x.begin(), x.end());
 			}
+			else if (ft::is_trivially_copyable<value_type>::value) {
+				if (n > 0)
+					std::memcpy(static_cast<void*>(_start), static_cast<const void*>(x._start), n * sizeof(value_type));
+				_finish = _start + n;
+			}
+			else if (n <= size()) {
+				pointer finish = std::copy(x._start, x._finish, _start);
+				ft::detail::destroy_range(_alloc, finish, _finish);
+				_finish = finish;
+			}
+			else {
+				std::copy(x._start, x._start + size(), _start);
+				_finish = ft::detail::construct_range(_alloc, x._start + size(), x._finish, _finish);
+			}
 			return *this;
 		}
 
@@ -109,26 +180,25 @@ namespace ft
 			else if (n > size())
 				insert(_finish, n - size(), val);
 		}
+		// ft extension: resize without value-initializing the new elements of a trivially copyable type,
+		// for a buffer that is written right after, e.g. by read(). Their value is indeterminate until then.
+		// Other types are value-initialized as by resize(n).
+		void			resize_uninitialized(size_type n) {
+			if (!ft::is_trivially_copyable<value_type>::value || n <= size())
+				resize(n);
+			else {
+				if (n > capacity())
+					reallocate(next_capacity(n));
+				_finish = _start + n;
+			}
+		}
 		size_type	capacity() const { return size_type(_end_of_storage - _start); }
 		bool			empty() const { return _start == _finish;}
 		void			reserve(size_type n) {
 			if (n > max_size())
 				throw std::length_error("Vector reserve error");
-			else if (n > capacity()) {
-				pointer start = _start;
-				pointer finish = _finish;
-				pointer end_of_storage = _end_of_storage;
-
-				_start = _alloc.allocate(n);
-				_finish = _start;
-				_end_of_storage = _start + n;
-				pointer tmp = start;
-				while (tmp != finish) {
-					_alloc.construct(_finish++, *tmp);
-					_alloc.destroy(tmp++);
-				}
-				_alloc.deallocate(start, end_of_storage - start);
-			}
+			else if (n > capacity())
+				reallocate(n);
 		}
 		// Element access:
 		reference 			operator[](size_type n) { return *(_start + n); }
@@ -152,147 +222,206 @@ namespace ft
 		void assign(InputIterator first, InputIterator last,
 								typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr) {
 			clear();
-			size_type n = ft::distance(first, last);
-			if (n <= capacity()) {
-				while (n--)
-					_alloc.construct(_finish++, *first++);
+			if (!ft::is_forward_iterator<InputIterator>::value) {
+				append_input(first, last);
+				return;
 			}
+			size_type n = ft::distance(first, last);
+			if (n <= capacity())
+				_finish = ft::detail::construct_range(_alloc, first, last, _start);
 			else {
-				pointer start = _start;
-				pointer end_of_storage = _end_of_storage;
-				_start = _alloc.allocate(n);
-				_finish = _start;
-				_end_of_storage = _start + n;
-				const_pointer tmp = &(*first);
-				while (tmp != &(*last))
-					_alloc.construct(_finish++, *tmp++);
-				_alloc.deallocate(start, end_of_storage - start);
+				size_type new_cap = next_capacity(n);
+				pointer start = _alloc.allocate(new_cap);
+				try {
+					ft::detail::construct_range(_alloc, first, last, start);
+				}
+				catch (...) {
+					_alloc.deallocate(start, new_cap);
+					throw;
+				}
+				_alloc.deallocate(_start, capacity());
+				_start = start;
+				_finish = start + n;
+				_end_of_storage = start + new_cap;
 			}
 		}	// range
 		void assign(size_type n, const value_type& val) {
 			clear();
-			if (n <= capacity()) {
-				while (n--)
-					_alloc.construct(_finish++, val);
-			}
+			if (n <= capacity())
+				_finish = ft::detail::construct_fill(_alloc, _start, n, val);
 			else {
-				pointer start = _start;
-				pointer end_of_storage = _end_of_storage;
-				_start = _alloc.allocate(n);
-				_finish = _start;
-				_end_of_storage = _start + n;
-				while (n--)
-					_alloc.construct(_finish++, val);
-				_alloc.deallocate(start, end_of_storage - start);
+				size_type new_cap = next_capacity(n);
+				pointer start = _alloc.allocate(new_cap);
+				try {
+					ft::detail::construct_fill(_alloc, start, n, val);
+				}
+				catch (...) {
+					_alloc.deallocate(start, new_cap);
+					throw;
+				}
+				_alloc.deallocate(_start, capacity());
+				_start = start;
+				_finish = start + n;
+				_end_of_storage = start + new_cap;
 			}
 		}	// fill
 		void push_back(const value_type& val) {
-			if (_finish == _end_of_storage) {
-				if (size() == 0)
-					reserve(1);
-				else
-					reserve(capacity() * 2);
+			if (_finish != _end_of_storage) {
+				_alloc.construct(_finish, val);
+				++_finish;
 			}
-			_alloc.construct(_finish++, val);
+			else
+				realloc_insert(_finish, 1, val);
+		}
+#if __cplusplus >= 201103L
+		template <class... Args>
+		void			emplace_back(Args&&... args) {
+			emplace_at(_finish, [&](void* p) { ::new (p) value_type(std::forward<Args>(args)...); });
+		}
+		template <class... Args>
+		iterator	emplace(iterator position, Args&&... args) {
+			return emplace_at(position.base(), [&](void* p) { ::new (p) value_type(std::forward<Args>(args)...); });
+		}
+#else
+		// Up to five constructor arguments, taken by const reference.
+		void			emplace_back() { emplace_at(_finish, ft::emplace_args0<value_type>()); }
+		template <class A1>
+		void			emplace_back(const A1& a1) { emplace_at(_finish, ft::emplace_args1<value_type, A1>(a1)); }
+		template <class A1, class A2>
+		void			emplace_back(const A1& a1, const A2& a2) {
+			emplace_at(_finish, ft::emplace_args2<value_type, A1, A2>(a1, a2));
+		}
+		template <class A1, class A2, class A3>
+		void			emplace_back(const A1& a1, const A2& a2, const A3& a3) {
+			emplace_at(_finish, ft::emplace_args3<value_type, A1, A2, A3>(a1, a2, a3));
+		}
+		template <class A1, class A2, class A3, class A4>
+		void			emplace_back(const A1& a1, const A2& a2, const A3& a3, const A4& a4) {
+			emplace_at(_finish, ft::emplace_args4<value_type, A1, A2, A3, A4>(a1, a2, a3, a4));
+		}
+		template <class A1, class A2, class A3, class A4, class A5>
+		void			emplace_back(const A1& a1, const A2& a2, const A3& a3, const A4& a4, const A5& a5) {
+			emplace_at(_finish, ft::emplace_args5<value_type, A1, A2, A3, A4, A5>(a1, a2, a3, a4, a5));
+		}
+		iterator	emplace(iterator position) { return emplace_at(position.base(), ft::emplace_args0<value_type>()); }
+		template <class A1>
+		iterator	emplace(iterator position, const A1& a1) {
+			return emplace_at(position.base(), ft::emplace_args1<value_type, A1>(a1));
+		}
+		template <class A1, class A2>
+		iterator	emplace(iterator position, const A1& a1, const A2& a2) {
+			return emplace_at(position.base(), ft::emplace_args2<value_type, A1, A2>(a1, a2));
 		}
+		template <class A1, class A2, class A3>
+		iterator	emplace(iterator position, const A1& a1, const A2& a2, const A3& a3) {
+			return emplace_at(position.base(), ft::emplace_args3<value_type, A1, A2, A3>(a1, a2, a3));
+		}
+		template <class A1, class A2, class A3, class A4>
+		iterator	emplace(iterator position, const A1& a1, const A2& a2, const A3& a3, const A4& a4) {
+			return emplace_at(position.base(), ft::emplace_args4<value_type, A1, A2, A3, A4>(a1, a2, a3, a4));
+		}
+		template <class A1, class A2, class A3, class A4, class A5>
+		iterator	emplace(iterator position, const A1& a1, const A2& a2, const A3& a3, const A4& a4, const A5& a5) {
+			return emplace_at(position.base(), ft::emplace_args5<value_type, A1, A2, A3, A4, A5>(a1, a2, a3, a4, a5));
+		}
+#endif
 		void pop_back() { _alloc.destroy(--_finish); }
 		iterator	insert(iterator position, const value_type& val) {
-			size_type n = &(*position) - _start;
+			size_type n = position.base() - _start;
 			insert(position, 1, val);
 			return _start + n;
 		}	// single element
 		void			insert(iterator position, size_type n, const value_type& val) {
-			if (size() + n <= capacity()) {
-				pointer val_tmp = _finish;
-				size_type range = _finish - &(*position);
-				_finish += n;
-				pointer tmp = _finish;
-
-				while (range--)
-					_alloc.construct(--tmp, *(--val_tmp));
-				while (n--)
-					_alloc.construct(--tmp, val);
+			if (ft::is_relocatable<value_type>::value && size_type(_end_of_storage - _finish) >= n) {
+				value_type copy(val);
+				pointer pos = position.base();
+				_finish = ft::detail::open_gap(pos, _finish, n);
+				try {
+					ft::detail::construct_fill(_alloc, pos, n, copy);
+				}
+				catch (...) {
+					_finish = ft::detail::close_gap(pos, _finish, n);
+					throw;
+				}
 			}
-			else {
-				pointer tmp = _start;
-				size_type _size = n + size();
-				size_type front_part = &(*position) - _start;
-				size_type back_part = _finish - &(*position);
-				_start = _alloc.allocate(_size);
-				_finish = _start;
-				_end_of_storage = _start + _size;
-
-				while (front_part--) {
-					_alloc.construct(_finish++, *tmp);
-					_alloc.destroy(tmp++);
+			else if (size_type(_end_of_storage - _finish) >= n) {
+				// Only the slots past _finish are constructed, the live ones are shifted.
+				value_type copy(val);
+				pointer pos = position.base();
+				pointer old_finish = _finish;
+				size_type after = old_finish - pos;
+				if (after > n) {
+					_finish = ft::detail::transfer_range(_alloc, old_finish - n, old_finish, old_finish);
+					ft::detail::shift_right(pos, old_finish - n, old_finish);
+					std::fill(pos, pos + n, copy);
 				}
-				while (n--)
-					_alloc.construct(_finish++, val);
-				while (back_part--) {
-					_alloc.construct(_finish++, *tmp);
-					_alloc.destroy(tmp++);
+				else {
+					_finish = ft::detail::construct_fill(_alloc, old_finish, n - after, copy);
+					_finish = ft::detail::transfer_range(_alloc, pos, old_finish, _finish);
+					std::fill(pos, old_finish, copy);
 				}
 			}
+			else
+				realloc_insert(position.base(), n, val);
 		}	// fill
 		template <class InputIterator>
 		void			insert(iterator position, InputIterator first, InputIterator last,
 										typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = ft_nullptr) {
+			if (!ft::is_forward_iterator<InputIterator>::value) {
+				if (position.base() == _finish)
+					append_input(first, last);
+				else {
+					vector tmp(first, last, _alloc);
+					insert(position, tmp.begin(), tmp.end());
+				}
+				return;
+			}
 			size_type n = ft::distance(first, last);
-			if (size() + n <= capacity()) {
-				pointer val_tmp = _finish;
-				size_type range = _finish - &(*position);
-				_finish += n;
-				pointer tmp = _finish;
-
-				while (range--)
-					_alloc.construct(--tmp, *(--val_tmp));
-				while (n--)
-					_alloc.construct(--tmp, *(--last));
+			if (ft::is_relocatable<value_type>::value && size_type(_end_of_storage - _finish) >= n) {
+				pointer pos = position.base();
+				_finish = ft::detail::open_gap(pos, _finish, n);
+				try {
+					ft::detail::construct_range(_alloc, first, last, pos);
+				}
+				catch (...) {
+					_finish = ft::detail::close_gap(pos, _finish, n);
+					throw;
+				}
 			}
-			else {
-				pointer tmp = _start;
-				size_type _size = n + size();
-				size_type front_part = &(*position) - _start;
-				size_type back_part = _finish - &(*position);
-				_start = _alloc.allocate(_size);
-				_finish = _start;
-				_end_of_storage = _start + _size;
-
-				while (front_part--) {
-					_alloc.construct(_finish++, *tmp);
-					_alloc.destroy(tmp++);
+			else if (size_type(_end_of_storage - _finish) >= n) {
+				pointer pos = position.base();
+				pointer old_finish = _finish;
+				size_type after = old_finish - pos;
+				if (after > n) {
+					_finish = ft::detail::transfer_range(_alloc, old_finish - n, old_finish, old_finish);
+					ft::detail::shift_right(pos, old_finish - n, old_finish);
+					std::copy(first, last, pos);
 				}
-				while (n--)
-					_alloc.construct(_finish++, *first++);
-				while (back_part--) {
-					_alloc.construct(_finish++, *tmp);
-					_alloc.destroy(tmp++);
+				else {
+					InputIterator mid = first;
+					ft::advance(mid, after);
+					_finish = ft::detail::construct_range(_alloc, mid, last, old_finish);
+					_finish = ft::detail::transfer_range(_alloc, pos, old_finish, _finish);
+					std::copy(first, mid, pos);
 				}
 			}
+			else
+				realloc_insert(position.base(), first, last, n);
 		}	// range
-		iterator erase(iterator position) {
-			_alloc.destroy(&(*position));
-			size_type n = _finish - &(*position) - 1;
-			pointer tmp = &(*position);
-			while (n--) {
-				_alloc.construct(tmp, *(tmp + 1));
-				_alloc.destroy(tmp++);
-			}
-			--_finish;
-			return position;
-		}
+		iterator erase(iterator position) { return erase(position, position + 1); }
 		iterator erase(iterator first, iterator last) {
-			pointer tmp = &(*first);
-			while (tmp != &(*last))
-				_alloc.destroy(tmp++);
-			size_type n = _finish - &(*last);
-			size_type range = ft::distance(first, last);
-			tmp = &(*first);
-			while (n--) {
-				_alloc.construct(tmp, *last++);
-				_alloc.destroy(tmp++);
+			if (first == last)
+				return first;
+			if (ft::is_relocatable<value_type>::value) {
+				ft::detail::destroy_range(_alloc, first.base(), last.base());
+				_finish = ft::detail::close_gap(first.base(), _finish, last - first);
+			}
+			else {
+				// The tail is shifted over the erased elements, only the ones left past the new end are destroyed.
+				pointer finish = ft::detail::shift_left(last.base(), _finish, first.base());
+				ft::detail::destroy_range(_alloc, finish, _finish);
+				_finish = finish;
 			}
-			_finish -= range;
 			return first;
 		}	// range
 		void swap(vector& x) {
@@ -315,10 +444,153 @@ namespace ft
 		// Allocator:
 		allocator_type get_allocator() const { return _alloc; }
 
+	private:
+		// Capacity for required elements according to the growth policy, at most max_size().
+		size_type next_capacity(size_type required) const {
+			if (required > max_size())
+				throw std::length_error("Vector length error");
+			size_type res = growth_policy::next_capacity(capacity(), required);
+			if (res < required || res > max_size())
+				res = max_size();
+			return res;
+		}
+
+		// Grows the buffer to new_cap elements through the allocator without copying the elements,
+		// when the allocator can (mmap_allocator) and they may be moved as bytes.
+		// Pointers into the old buffer are invalid afterwards.
+		bool grow_in_place(size_type new_cap) {
+			if (!ft::is_relocatable<value_type>::value || _start == ft_nullptr)
+				return false;
+			pointer start = ft::reallocate_in_place<allocator_type>::reallocate(_alloc, _start, capacity(), new_cap);
+			if (start == ft_nullptr)
+				return false;
+			_finish = start + (_finish - _start);
+			_start = start;
+			_end_of_storage = start + new_cap;
+			return true;
+		}
+
+		// Moves the elements to a new buffer of new_cap elements.
+		void reallocate(size_type new_cap) {
+			if (grow_in_place(new_cap))
+				return;
+			pointer start = _alloc.allocate(new_cap);
+			pointer finish;
+			if (ft::is_relocatable<value_type>::value)
+				finish = ft::detail::relocate_range(_start, _finish, start);
+			else {
+				try {
+					finish = ft::detail::transfer_range(_alloc, _start, _finish, start);
+				}
+				catch (...) {
+					_alloc.deallocate(start, new_cap);
+					throw;
+				}
+				ft::detail::destroy_range(_alloc, _start, _finish);
+			}
+			_alloc.deallocate(_start, capacity());
+			_start = start;
+			_finish = finish;
+			_end_of_storage = start + new_cap;
+		}
+
+		// Insertion that does not fit: the n new elements are built in a new buffer first,
+		// so val may be an element of this vector, then the old ones are copied around them.
+		void realloc_insert(pointer position, size_type n, const value_type& val) {
+			size_type new_cap = next_capacity(size() + n);
+			if (position == _finish && ft::is_relocatable<value_type>::value) {
+				value_type tmp(val);
+				if (grow_in_place(new_cap)) {
+					_finish = ft::detail::construct_fill(_alloc, _finish, n, tmp);
+					return;
+				}
+			}
+			pointer start = _alloc.allocate(new_cap);
+			pointer gap = start + (position - _start);
+			try {
+				ft::detail::construct_fill(_alloc, gap, n, val);
+			}
+			catch (...) {
+				_alloc.deallocate(start, new_cap);
+				throw;
+			}
+			relocate_around(start, new_cap, position, gap, n);
+		}
+
+		template <class InputIterator>
+		void realloc_insert(pointer position, InputIterator first, InputIterator last, size_type n) {
+			size_type new_cap = next_capacity(size() + n);
+			pointer start = _alloc.allocate(new_cap);
+			pointer gap = start + (position - _start);
+			try {
+				ft::detail::construct_range(_alloc, first, last, gap);
+			}
+			catch (...) {
+				_alloc.deallocate(start, new_cap);
+				throw;
+			}
+			relocate_around(start, new_cap, position, gap, n);
+		}
+
+		// Builds one element at position with construct(void*), no temporary is copied.
+		// The arguments may refer to elements of this vector, so the element is always built
+		// before anything moves: in a new buffer, or in the free slot at _finish and then
+		// rotated into place.
+		template <class Construct>
+		pointer emplace_at(pointer position, const Construct& construct) {
+			size_type offset = position - _start;
+			if (_finish == _end_of_storage) {
+				size_type new_cap = next_capacity(size() + 1);
+				pointer start = _alloc.allocate(new_cap);
+				pointer gap = start + offset;
+				try {
+					construct(static_cast<void*>(gap));
+				}
+				catch (...) {
+					_alloc.deallocate(start, new_cap);
+					throw;
+				}
+				relocate_around(start, new_cap, position, gap, 1);
+			}
+			else if (position == _finish) {
+				construct(static_cast<void*>(_finish));
+				++_finish;
+			}
+			else if (ft::is_relocatable<value_type>::value) {
+				char bytes[sizeof(value_type)];
+				construct(static_cast<void*>(_finish));
+				std::memcpy(bytes, static_cast<const void*>(_finish), sizeof(value_type));
+				_finish = ft::detail::open_gap(position, _finish, 1);
+				std::memcpy(static_cast<void*>(position), bytes, sizeof(value_type));
+			}
+			else {
+				construct(static_cast<void*>(_finish));
+				++_finish;
+				std::rotate(position, _finish - 1, _finish);
+			}
+			return _start + offset;
+		}
+
+		// Single-pass ranges cannot be counted first, they are appended with geometric growth.
+		template <class InputIterator>
+		void append_input(InputIterator first, InputIterator last) {
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+
+		// Copies [_start, position) before gap and [position, _finish) after the n elements
+		// already built at gap, then frees the old buffer and takes the new one.
+		void relocate_around(pointer start, size_type new_cap, pointer position, pointer gap, size_type n) {
+			pointer finish = ft::detail::relocate_around(_alloc, _start, position, _finish, start, new_cap, gap, n);
+			_alloc.deallocate(_start, capacity());
+			_start = start;
+			_finish = finish;
+			_end_of_storage = start + new_cap;
+		}
+
 		/**
 		 * @brief Member variables
 		 */
-	private:
 		allocator_type	_alloc;
 		pointer					_start;
 		pointer					_finish;
@@ -326,39 +598,35 @@ namespace ft
 	};
 
 	// Relational operators
-	template <class T, class Alloc>
-	inline bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
-		if (lhs.size() != rhs.size())
-			return false;
-		typename ft::vector<T, Alloc>::const_iterator lhs_it = lhs.begin();
-		typename ft::vector<T, Alloc>::const_iterator rhs_it = rhs.begin();
-		while (lhs_it != lhs.end()) {
-			if (rhs_it == rhs.end() || *lhs_it++ != *rhs_it++)
-				return false;
-		}
-		return true;
+	template <class T, class Alloc, class Growth>
+	inline bool operator==(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal_contiguous(lhs.begin().base(), rhs.begin().base(), lhs.size());
 	}
 
-	template <class T, class Alloc>
-	inline bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) { return !(lhs == rhs); }
+	template <class T, class Alloc, class Growth>
+	inline bool operator!=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) { return !(lhs == rhs); }
 
-	template <class T, class Alloc>
-	inline bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
-		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	template <class T, class Alloc, class Growth>
+	inline bool operator<(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
+		return ft::less_contiguous(lhs.begin().base(), lhs.size(), rhs.begin().base(), rhs.size());
 	}
 
-	template <class T, class Alloc>
-	inline bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) { return !(rhs < lhs); }
+	template <class T, class Alloc, class Growth>
+	inline bool operator<=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) { return !(rhs < lhs); }
 
-	template <class T, class Alloc>
-	inline bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) { return rhs < lhs; }
+	template <class T, class Alloc, class Growth>
+	inline bool operator>(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) { return rhs < lhs; }
 
-	template <class T, class Alloc>
-	inline bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) { return !(lhs < rhs); }
+	template <class T, class Alloc, class Growth>
+	inline bool operator>=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) { return !(lhs < rhs); }
 
 	// swap
-	template <class T, class Alloc>
-	inline void swap(vector<T, Alloc>& x, vector<T, Alloc>& y) { x.swap(y); }
+	template <class T, class Alloc, class Growth>
+	inline void swap(vector<T, Alloc, Growth>& x, vector<T, Alloc, Growth>& y) { x.swap(y); }
+
+	// A vector moves by swapping its buffer pointers.
+	template <class T, class Alloc, class Growth>
+	struct is_swap_relocatable<vector<T, Alloc, Growth> > { enum _value { value = true }; };
 } // namespace ft
 
 #endif
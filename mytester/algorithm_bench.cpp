@@ -0,0 +1,153 @@
+#include "algorithm.hpp"
+#include "vector.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief algorithm benchmark
+ * Runs ft::sort, stable_sort, partial_sort and nth_element on ft::vector
+ * against the std algorithms on std::vector, on the same inputs.
+ * The optional argument scales the biggest input size (default: 1000000).
+ */
+
+static volatile long g_sink = 0;	// Keeps the optimizer from dropping the measured calls.
+
+enum Algo { SORT, STABLE_SORT, PARTIAL_SORT, NTH_ELEMENT };
+
+static const char* g_patterns[4] = { "random", "sorted", "reversed", "16 values" };
+
+double ns_per_element(clock_t start, clock_t end, long n) {
+	return static_cast<double>(end - start) * 1e9 / CLOCKS_PER_SEC / n;
+}
+
+int makeInt(int pattern, long i, long n) {
+	if (pattern == 0)
+		return rand();
+	if (pattern == 1)
+		return static_cast<int>(i);
+	if (pattern == 2)
+		return static_cast<int>(n - i);
+	return rand() % 16;
+}
+
+std::string makeString(int pattern, long i, long n) {
+	char buf[32];
+	sprintf(buf, "key-%020d", makeInt(pattern, i, n));
+	return buf;
+}
+
+void runAlgo(ft::vector<int>& vec, Algo algo) {
+	if (algo == SORT)
+		ft::sort(vec.begin(), vec.end());
+	else if (algo == STABLE_SORT)
+		ft::stable_sort(vec.begin(), vec.end());
+	else if (algo == PARTIAL_SORT)
+		ft::partial_sort(vec.begin(), vec.begin() + vec.size() / 100, vec.end());
+	else
+		ft::nth_element(vec.begin(), vec.begin() + vec.size() / 2, vec.end());
+}
+
+void runAlgo(std::vector<int>& vec, Algo algo) {
+	if (algo == SORT)
+		std::sort(vec.begin(), vec.end());
+	else if (algo == STABLE_SORT)
+		std::stable_sort(vec.begin(), vec.end());
+	else if (algo == PARTIAL_SORT)
+		std::partial_sort(vec.begin(), vec.begin() + vec.size() / 100, vec.end());
+	else
+		std::nth_element(vec.begin(), vec.begin() + vec.size() / 2, vec.end());
+}
+
+// Builds reps copies of the input first, so only the algorithm is timed. Returns ns per element.
+template <typename Vector>
+double benchInts(long n, int pattern, Algo algo) {
+	long reps = 2000000 / n + 1;
+	std::vector<Vector> inputs(reps);
+	for (long r = 0; r < reps; ++r) {
+		srand(static_cast<unsigned int>(r));
+		for (long i = 0; i < n; ++i)
+			inputs[r].push_back(makeInt(pattern, i, n));
+	}
+	clock_t start = clock();
+	for (long r = 0; r < reps; ++r)
+		runAlgo(inputs[r], algo);
+	double res = ns_per_element(start, clock(), n * reps);
+	g_sink += inputs[0][n / 2];
+	return res;
+}
+
+template <typename Vector>
+double benchStrings(long n, int pattern, bool stable) {
+	Vector vec;
+	srand(1);
+	for (long i = 0; i < n; ++i)
+		vec.push_back(makeString(pattern, i, n));
+	clock_t start = clock();
+	if (stable)
+		ft::stable_sort(vec.begin(), vec.end());
+	else
+		ft::sort(vec.begin(), vec.end());
+	double res = ns_per_element(start, clock(), n);
+	g_sink += vec[n / 2].size();
+	return res;
+}
+
+template <>
+double benchStrings<std::vector<std::string> >(long n, int pattern, bool stable) {
+	std::vector<std::string> vec;
+	srand(1);
+	for (long i = 0; i < n; ++i)
+		vec.push_back(makeString(pattern, i, n));
+	clock_t start = clock();
+	if (stable)
+		std::stable_sort(vec.begin(), vec.end());
+	else
+		std::sort(vec.begin(), vec.end());
+	double res = ns_per_element(start, clock(), n);
+	g_sink += vec[n / 2].size();
+	return res;
+}
+
+void runInts(long max_n, Algo algo, const std::string& title) {
+	std::cout << "\n===== " << title << " of ints (ns/element) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(12) << "input" << std::setw(14) << "ft" << std::setw(14) << "std" << std::endl;
+	for (long n = 1000; n <= max_n; n *= 10) {
+		for (int pattern = 0; pattern < 4; ++pattern) {
+			std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n << std::setw(12) << g_patterns[pattern]
+								<< std::setw(14) << benchInts<ft::vector<int> >(n, pattern, algo)
+								<< std::setw(14) << benchInts<std::vector<int> >(n, pattern, algo) << std::endl;
+		}
+	}
+}
+
+void runStrings(long max_n) {
+	std::cout << "\n===== sort / stable_sort of strings (ns/element) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(12) << "input" << std::setw(14) << "ft sort" << std::setw(14) << "std sort"
+						<< std::setw(14) << "ft stable" << std::setw(14) << "std stable" << std::endl;
+	for (int pattern = 0; pattern < 4; ++pattern) {
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << max_n << std::setw(12) << g_patterns[pattern]
+							<< std::setw(14) << benchStrings<ft::vector<std::string> >(max_n, pattern, false)
+							<< std::setw(14) << benchStrings<std::vector<std::string> >(max_n, pattern, false)
+							<< std::setw(14) << benchStrings<ft::vector<std::string> >(max_n, pattern, true)
+							<< std::setw(14) << benchStrings<std::vector<std::string> >(max_n, pattern, true) << std::endl;
+	}
+}
+
+int main(int argc, char** argv) {
+	long max_n = 1000000;
+	if (argc > 1)
+		max_n = atol(argv[1]);
+	std::cout << "################ Bench Algorithm ################" << std::endl;
+	runInts(max_n, SORT, "sort");
+	runInts(max_n, STABLE_SORT, "stable_sort");
+	runInts(max_n, PARTIAL_SORT, "partial_sort of the first n / 100");
+	runInts(max_n, NTH_ELEMENT, "nth_element of n / 2");
+	runStrings(max_n);
+	return 0;
+}
@@ -0,0 +1,159 @@
+#include "algorithm.hpp"
+#include "vector.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+struct Entry {
+	int					key;
+	std::string	name;
+
+	Entry(int k = 0, const std::string& n = "") : key(k), name(n) {}
+};
+
+struct ByKey {
+	bool operator()(const Entry& x, const Entry& y) const { return x.key < y.key; }
+};
+
+std::ostream& operator<<(std::ostream& os, const Entry& e) { return os << e.key << ":" << e.name; }
+
+template <typename V>
+void printContainers(V const &vec, size_t count) {
+	std::cout << "size: " << vec.size() << std::endl;
+	std::cout << "content:";
+	for (size_t i = 0; i < count && i < vec.size(); ++i)
+		std::cout << " " << vec[i];
+	std::cout << std::endl << "------------------------" << std::endl;
+}
+
+// Input patterns of the benchmarks: random, sorted, reversed, few distinct values and organ pipe.
+template <typename V>
+V makeInts(int pattern, int n) {
+	V vec;
+	for (int i = 0; i < n; ++i) {
+		if (pattern == 0)
+			vec.push_back(rand() % 1000);
+		else if (pattern == 1)
+			vec.push_back(i);
+		else if (pattern == 2)
+			vec.push_back(n - i);
+		else if (pattern == 3)
+			vec.push_back(rand() % 4);
+		else
+			vec.push_back(i < n / 2 ? i : n - i);
+	}
+	return vec;
+}
+
+template <typename V>
+bool isSorted(const V& vec) {
+	for (size_t i = 1; i < vec.size(); ++i)
+		if (vec[i] < vec[i - 1])
+			return false;
+	return true;
+}
+
+int main() {
+	std::cout << "################ Test Algorithm ################" << std::endl;
+	typedef TESTED_NAMESPACE::vector<int>	int_vector;
+
+	std::cout << "===== sort =====" << std::endl;
+	const int sizes[6] = { 0, 1, 2, 17, 100, 5000 };
+	for (int pattern = 0; pattern < 5; ++pattern) {
+		for (int i = 0; i < 6; ++i) {
+			srand(pattern * 10 + i);
+			int_vector vec = makeInts<int_vector>(pattern, sizes[i]);
+			TESTED_NAMESPACE::sort(vec.begin(), vec.end());
+			std::cout << "pattern " << pattern << " sorted: " << (isSorted(vec) ? "OK" : "KO") << " ";
+			printContainers(vec, 20);
+		}
+	}
+	int_vector v_greater = makeInts<int_vector>(0, 50);
+	TESTED_NAMESPACE::sort(v_greater.begin(), v_greater.end(), std::greater<int>());
+	printContainers(v_greater, 50);
+	int arr[8] = { 5, -3, 8, 0, 8, -7, 2, 1 };
+	TESTED_NAMESPACE::sort(arr, arr + 8);
+	std::cout << "array:";
+	for (int i = 0; i < 8; ++i)
+		std::cout << " " << arr[i];
+	std::cout << std::endl;
+
+	const std::string words[10] = { "pear", "apple", "a string too long for the small string buffer", "fig", "kiwi",
+																	"banana", "apple", "cherry", "date", "another string that lives on the heap" };
+	TESTED_NAMESPACE::vector<std::string> v_words;
+	for (int i = 0; i < 40; ++i)
+		v_words.push_back(words[(i * 7) % 10]);
+	TESTED_NAMESPACE::sort(v_words.begin(), v_words.end());
+	printContainers(v_words, 40);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== stable_sort =====" << std::endl;
+	TESTED_NAMESPACE::vector<Entry> v_entries;
+	for (int i = 0; i < 300; ++i)
+		v_entries.push_back(Entry((i * 37) % 11, words[i % 10].substr(0, 4)));
+	TESTED_NAMESPACE::stable_sort(v_entries.begin(), v_entries.end(), ByKey());
+	printContainers(v_entries, 300);
+	for (int pattern = 0; pattern < 5; ++pattern) {
+		srand(pattern);
+		int_vector vec = makeInts<int_vector>(pattern, 1000);
+		TESTED_NAMESPACE::stable_sort(vec.begin(), vec.end());
+		std::cout << "pattern " << pattern << " sorted: " << (isSorted(vec) ? "OK" : "KO") << " ";
+		printContainers(vec, 20);
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== partial_sort =====" << std::endl;
+	const int counts[4] = { 0, 1, 10, 1000 };
+	for (int pattern = 0; pattern < 5; ++pattern) {
+		for (int i = 0; i < 4; ++i) {
+			srand(pattern + 100);
+			int_vector vec = makeInts<int_vector>(pattern, 1000);
+			TESTED_NAMESPACE::partial_sort(vec.begin(), vec.begin() + counts[i], vec.end());
+			std::cout << "pattern " << pattern << " first " << counts[i] << ": ";
+			printContainers(vec, counts[i] < 20 ? counts[i] : 20);
+		}
+	}
+	TESTED_NAMESPACE::vector<std::string> v_partial(words, words + 10);
+	TESTED_NAMESPACE::partial_sort(v_partial.begin(), v_partial.begin() + 4, v_partial.end(), std::greater<std::string>());
+	printContainers(v_partial, 4);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== nth_element =====" << std::endl;
+	const int nths[4] = { 0, 1, 500, 999 };
+	for (int pattern = 0; pattern < 5; ++pattern) {
+		for (int i = 0; i < 4; ++i) {
+			srand(pattern + 200);
+			int_vector vec = makeInts<int_vector>(pattern, 1000);
+			int_vector::iterator nth = vec.begin() + nths[i];
+			TESTED_NAMESPACE::nth_element(vec.begin(), nth, vec.end());
+			bool partitioned = true;
+			for (int_vector::iterator it = vec.begin(); it != vec.end(); ++it)
+				if ((it < nth && *nth < *it) || (it > nth && *it < *nth))
+					partitioned = false;
+			std::cout << "pattern " << pattern << " nth " << nths[i] << ": " << *nth
+								<< " partitioned: " << (partitioned ? "OK" : "KO") << std::endl;
+		}
+	}
+	TESTED_NAMESPACE::vector<std::string> v_nth(words, words + 10);
+	TESTED_NAMESPACE::nth_element(v_nth.begin(), v_nth.begin() + 5, v_nth.end());
+	std::cout << "nth string: " << v_nth[5] << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== std heap algorithms through ADL =====" << std::endl;
+	// Only the four algorithms are public, an unqualified make_heap on ft iterators is not ambiguous.
+	using std::make_heap;
+	using std::sort_heap;
+	int_vector v_heap = makeInts<int_vector>(0, 30);
+	make_heap(v_heap.begin(), v_heap.end(), std::less<int>());
+	std::cout << "heap top: " << v_heap.front() << std::endl;
+	sort_heap(v_heap.begin(), v_heap.end(), std::less<int>());
+	printContainers(v_heap, 30);
+	return 0;
+}
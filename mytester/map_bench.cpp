@@ -0,0 +1,487 @@
+#include "map.hpp"
+#include "pool_allocator.hpp"
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <ctime>
+#include <cstdlib>
+#include <new>
+
+#define BENCH_QUERIES 1000000
+
+/**
+ * @brief map benchmark
+ * Runs the same workload on ft::map and std::map and prints the time per operation.
+ * The optional argument scales the biggest container size (default: 1000000).
+ */
+
+static volatile long g_sink = 0;	// Keeps the optimizer from dropping the measured loops.
+static long g_news = 0;						// Number of calls to operator new.
+
+// The replacement pair below is matched, g++ only sees malloc / free behind new / delete.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(size_t size) throw(std::bad_alloc) {
+	++g_news;
+	void* res = malloc(size == 0 ? 1 : size);
+	if (res == ft::ft_nullptr)
+		throw std::bad_alloc();
+	return res;
+}
+
+void operator delete(void* p) throw() { free(p); }
+
+double ns_per_op(clock_t start, clock_t end, long ops) {
+	return static_cast<double>(end - start) * 1e9 / CLOCKS_PER_SEC / ops;
+}
+
+void printHeader(const std::string& title) {
+	std::cout << "\n===== " << title << " =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(16) << "ft (ns/op)" << std::setw(16) << "std (ns/op)" << std::endl;
+}
+
+void printRow(long n, double ft_time, double std_time) {
+	std::cout << std::fixed << std::setprecision(1)
+						<< std::setw(10) << n << std::setw(16) << ft_time << std::setw(16) << std_time << std::endl;
+}
+
+template <typename Map>
+void fillMap(Map& mp, long n) {
+	for (long i = 0; i < n; ++i)
+		mp.insert(typename Map::value_type(static_cast<int>(i * 2), static_cast<int>(i)));
+}
+
+template <typename Map>
+double benchBounds(const Map& mp, const std::vector<int>& probes) {
+	clock_t start = clock();
+	long sum = 0;
+	for (size_t i = 0; i < probes.size(); ++i) {
+		typename Map::const_iterator lower = mp.lower_bound(probes[i]);
+		typename Map::const_iterator upper = mp.upper_bound(probes[i]);
+		if (lower != mp.end())
+			sum += lower->second;
+		if (upper != mp.end())
+			sum += upper->second;
+		sum += (mp.equal_range(probes[i]).first == lower);
+	}
+	g_sink += sum;
+	return ns_per_op(start, clock(), probes.size());
+}
+
+template <typename Map>
+double benchFind(const Map& mp, const std::vector<int>& probes) {
+	clock_t start = clock();
+	long sum = 0;
+	for (size_t i = 0; i < probes.size(); ++i) {
+		typename Map::const_iterator it = mp.find(probes[i]);
+		if (it != mp.end())
+			sum += it->second;
+	}
+	g_sink += sum;
+	return ns_per_op(start, clock(), probes.size());
+}
+
+void runFind(long max_n) {
+	printHeader("find (hit)");
+	for (long n = 1000; n <= max_n; n *= 10) {
+		ft::map<int, int> ft_mp;
+		std::map<int, int> std_mp;
+		fillMap(ft_mp, n);
+		fillMap(std_mp, n);
+
+		std::vector<int> probes(BENCH_QUERIES);
+		for (size_t i = 0; i < probes.size(); ++i)
+			probes[i] = (rand() % n) * 2;
+		printRow(n, benchFind(ft_mp, probes), benchFind(std_mp, probes));
+	}
+}
+
+template <typename Map>
+double benchDuplicate(Map& mp, const std::vector<int>& probes) {
+	clock_t start = clock();
+	long sum = 0;
+	for (size_t i = 0; i < probes.size(); ++i) {
+		sum += mp.insert(typename Map::value_type(probes[i], 0)).second;
+		sum += mp[probes[i]];
+	}
+	g_sink += sum;
+	return ns_per_op(start, clock(), probes.size());
+}
+
+void runDuplicate(long max_n) {
+	printHeader("insert + operator[] (existing key)");
+	for (long n = 1000; n <= max_n; n *= 10) {
+		ft::map<int, int> ft_mp;
+		std::map<int, int> std_mp;
+		fillMap(ft_mp, n);
+		fillMap(std_mp, n);
+
+		std::vector<int> probes(BENCH_QUERIES);
+		for (size_t i = 0; i < probes.size(); ++i)
+			probes[i] = (rand() % n) * 2;
+		printRow(n, benchDuplicate(ft_mp, probes), benchDuplicate(std_mp, probes));
+	}
+}
+
+static long g_records = 0;	// Number of Record constructions.
+
+struct Record {
+	int data[64];
+	Record() { for (int i = 0; i < 64; ++i) data[i] = i; ++g_records; }
+	Record(const Record& x) { for (int i = 0; i < 64; ++i) data[i] = x.data[i]; ++g_records; }
+};
+
+template <typename Map>
+double benchLargeValue(const Map& mp, const std::vector<int>& probes) {
+	clock_t start = clock();
+	long sum = 0;
+	for (size_t i = 0; i < probes.size(); ++i) {
+		sum += mp.count(probes[i]);
+		typename Map::const_iterator it = mp.lower_bound(probes[i]);
+		if (it != mp.end())
+			sum += it->second.data[0];
+	}
+	g_sink += sum;
+	return ns_per_op(start, clock(), probes.size());
+}
+
+void runLargeValue(long max_n) {
+	printHeader("count + lower_bound, 256-byte mapped_type");
+	for (long n = 1000; n <= max_n && n <= 100000; n *= 10) {
+		ft::map<int, Record> ft_mp;
+		std::map<int, Record> std_mp;
+		for (long i = 0; i < n; ++i) {
+			ft_mp.insert(ft::make_pair(static_cast<int>(i * 2), Record()));
+			std_mp.insert(std::make_pair(static_cast<int>(i * 2), Record()));
+		}
+
+		std::vector<int> probes(BENCH_QUERIES);
+		for (size_t i = 0; i < probes.size(); ++i)
+			probes[i] = rand() % (2 * n);
+		g_records = 0;
+		double ft_time = benchLargeValue(ft_mp, probes);
+		long ft_records = g_records;
+		g_records = 0;
+		double std_time = benchLargeValue(std_mp, probes);
+		printRow(n, ft_time, std_time);
+		std::cout << std::setw(10) << "records" << std::setw(16) << ft_records << std::setw(16) << g_records << std::endl;
+	}
+}
+
+template <typename Map>
+double benchStringProbe(const Map& mp, const std::vector<std::string>& keys) {
+	clock_t start = clock();
+	long sum = 0;
+	for (size_t i = 0; i < BENCH_QUERIES; ++i) {
+		typename Map::const_iterator it = mp.find(keys[i % keys.size()].c_str());
+		if (it != mp.end())
+			sum += it->second;
+	}
+	g_sink += sum;
+	return ns_per_op(start, clock(), BENCH_QUERIES);
+}
+
+void runStringProbe(long max_n) {
+	std::cout << "\n===== find(const char*) on std::string keys =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(16) << "ft::less<>" << std::setw(16) << "std::less" << std::endl;
+	for (long n = 1000; n <= max_n && n <= 100000; n *= 10) {
+		ft::map<std::string, int, ft::less<> > ft_mp;
+		std::map<std::string, int> std_mp;
+		std::vector<std::string> keys;
+		for (long i = 0; i < n; ++i) {
+			std::ostringstream oss;
+			oss << "request-header-key-" << rand();
+			keys.push_back(oss.str());
+			ft_mp.insert(ft::make_pair(oss.str(), static_cast<int>(i)));
+			std_mp.insert(std::make_pair(oss.str(), static_cast<int>(i)));
+		}
+		printRow(n, benchStringProbe(ft_mp, keys), benchStringProbe(std_mp, keys));
+	}
+}
+
+static long g_compares = 0;	// Number of comparator calls.
+
+struct CountingLess {
+	bool operator()(const std::string& x, const std::string& y) const { ++g_compares; return x < y; }
+};
+
+// Opts in to the single-call descent of ft::map, see ft::three_way.
+struct CountingThreeWay {
+	typedef void is_three_way;
+	bool operator()(const std::string& x, const std::string& y) const { ++g_compares; return x < y; }
+	int compare(const std::string& x, const std::string& y) const { ++g_compares; return x.compare(y); }
+};
+
+// Comparator calls per operation: n inserts of random keys, then the finds.
+template <typename Map>
+void countCompares(const std::vector<std::string>& keys, double& per_insert, double& per_find) {
+	Map mp;
+	g_compares = 0;
+	for (size_t i = 0; i < keys.size(); ++i)
+		mp.insert(typename Map::value_type(keys[i], static_cast<int>(i)));
+	per_insert = static_cast<double>(g_compares) / keys.size();
+	g_compares = 0;
+	long sum = 0;
+	for (size_t i = 0; i < BENCH_QUERIES; ++i)
+		sum += (mp.find(keys[(i * 7919) % keys.size()]) != mp.end());
+	g_sink += sum;
+	per_find = static_cast<double>(g_compares) / BENCH_QUERIES;
+}
+
+void runCompareCount(long max_n) {
+	std::cout << "\n===== comparator calls per insert (n row) and per find, std::string keys =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(16) << "ft less" << std::setw(16) << "ft three-way"
+						<< std::setw(16) << "std less" << std::endl;
+	for (long n = 1000; n <= max_n && n <= 100000; n *= 10) {
+		std::vector<std::string> keys;
+		for (long i = 0; i < n; ++i) {
+			std::ostringstream oss;
+			oss << "session/" << rand();
+			keys.push_back(oss.str());
+		}
+		double calls[3][2];
+		countCompares<ft::map<std::string, int, CountingLess> >(keys, calls[0][0], calls[0][1]);
+		countCompares<ft::map<std::string, int, CountingThreeWay> >(keys, calls[1][0], calls[1][1]);
+		countCompares<std::map<std::string, int, CountingLess> >(keys, calls[2][0], calls[2][1]);
+		std::cout << std::fixed << std::setprecision(1);
+		std::cout << std::setw(10) << n << std::setw(16) << calls[0][0] << std::setw(16) << calls[1][0]
+							<< std::setw(16) << calls[2][0] << std::endl;
+		std::cout << std::setw(10) << "find" << std::setw(16) << calls[0][1] << std::setw(16) << calls[1][1]
+							<< std::setw(16) << calls[2][1] << std::endl;
+	}
+}
+
+template <typename Map>
+double benchPopMin(Map& mp, long n) {
+	clock_t start = clock();
+	long sum = 0;
+	// Priority queue pattern: take the smallest entry, push a bigger one.
+	for (long i = 0; i < BENCH_QUERIES; ++i) {
+		typename Map::iterator first = mp.begin();
+		sum += first->second;
+		int key = first->first + static_cast<int>(2 * n) + rand() % 64;
+		mp.erase(first);
+		mp.insert(typename Map::value_type(key, static_cast<int>(i)));
+		sum += (--mp.end())->first;
+	}
+	g_sink += sum;
+	return ns_per_op(start, clock(), BENCH_QUERIES);
+}
+
+void runPopMin(long max_n) {
+	printHeader("erase(begin()) + insert + --end()");
+	for (long n = 1000; n <= max_n; n *= 10) {
+		ft::map<int, int> ft_mp;
+		std::map<int, int> std_mp;
+		fillMap(ft_mp, n);
+		fillMap(std_mp, n);
+		printRow(n, benchPopMin(ft_mp, n), benchPopMin(std_mp, n));
+	}
+}
+
+template <typename Map>
+double benchCopy(const Map& src, Map& dst) {
+	clock_t start = clock();
+	Map copy(src);	// copy constructor
+	dst = copy;			// assignment into a tree of the same size
+	g_sink += copy.size() + dst.size();
+	return ns_per_op(start, clock(), 2 * src.size());
+}
+
+void runCopy(long max_n) {
+	printHeader("copy constructor + operator= (per element)");
+	for (long n = 1000; n <= max_n; n *= 10) {
+		ft::map<int, int> ft_mp;
+		ft::map<int, int> ft_dst;
+		std::map<int, int> std_mp;
+		std::map<int, int> std_dst;
+		fillMap(ft_mp, n);
+		fillMap(ft_dst, n);
+		fillMap(std_mp, n);
+		fillMap(std_dst, n);
+		printRow(n, benchCopy(ft_mp, ft_dst), benchCopy(std_mp, std_dst));
+	}
+}
+
+template <typename Map, typename Pair>
+double benchBuild(const std::vector<Pair>& values, bool one_by_one) {
+	clock_t start = clock();
+	if (one_by_one) {
+		Map mp;
+		for (size_t i = 0; i < values.size(); ++i)
+			mp.insert(values[i]);
+		g_sink += mp.size();
+	}
+	else {
+		Map mp(values.begin(), values.end());
+		g_sink += mp.size();
+	}
+	return ns_per_op(start, clock(), values.size());
+}
+
+void runBuild(long max_n) {
+	std::cout << "\n===== build from a sorted range (ns/element) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(16) << "ft range" << std::setw(16) << "ft sorted_uniq"
+						<< std::setw(16) << "ft insert" << std::setw(16) << "std range" << std::endl;
+	for (long n = 1000; n <= max_n; n *= 10) {
+		std::vector<ft::pair<int, int> > ft_values;
+		std::vector<std::pair<int, int> > std_values;
+		for (long i = 0; i < n; ++i) {
+			ft_values.push_back(ft::make_pair(static_cast<int>(i * 2), static_cast<int>(i)));
+			std_values.push_back(std::make_pair(static_cast<int>(i * 2), static_cast<int>(i)));
+		}
+		double ft_range = benchBuild<ft::map<int, int> >(ft_values, false);
+		clock_t start = clock();
+		{
+			ft::map<int, int> mp(ft::sorted_unique, ft_values.begin(), ft_values.end());
+			g_sink += mp.size();
+		}
+		double ft_tagged = ns_per_op(start, clock(), n);
+		double ft_insert = benchBuild<ft::map<int, int> >(ft_values, true);
+		double std_range = benchBuild<std::map<int, int> >(std_values, false);
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n << std::setw(16) << ft_range
+							<< std::setw(16) << ft_tagged << std::setw(16) << ft_insert << std::setw(16) << std_range << std::endl;
+	}
+}
+
+template <typename Map>
+double benchAppend(long n, bool hinted) {
+	Map mp;
+	clock_t start = clock();
+	// Monotonically increasing keys, like timestamps.
+	for (long i = 0; i < n; ++i) {
+		if (hinted)
+			mp.insert(mp.end(), typename Map::value_type(static_cast<int>(i), 0));
+		else
+			mp.insert(typename Map::value_type(static_cast<int>(i), 0));
+	}
+	double res = ns_per_op(start, clock(), n);
+	g_sink += mp.size();
+	return res;
+}
+
+void runAppend(long max_n) {
+	std::cout << "\n===== insert increasing keys (ns/op) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(16) << "ft end() hint" << std::setw(16) << "ft no hint"
+						<< std::setw(16) << "std end() hint" << std::endl;
+	for (long n = 1000; n <= max_n; n *= 10) {
+		double ft_hinted = benchAppend<ft::map<int, int> >(n, true);
+		double ft_plain = benchAppend<ft::map<int, int> >(n, false);
+		double std_hinted = benchAppend<std::map<int, int> >(n, true);
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n << std::setw(16) << ft_hinted
+							<< std::setw(16) << ft_plain << std::setw(16) << std_hinted << std::endl;
+	}
+}
+
+// Fill, churn (erase + insert), in-order scan and clear. Returns ns per element of the fill.
+template <typename Map>
+double benchChurn(long n, long& news) {
+	g_news = 0;
+	clock_t start = clock();
+	{
+		Map mp;
+		for (long i = 0; i < n; ++i)
+			mp[rand() % (4 * n)] = static_cast<int>(i);
+		for (long i = 0; i < n; ++i) {
+			mp.erase(rand() % (4 * n));
+			mp[rand() % (4 * n)] = static_cast<int>(i);
+		}
+		long sum = 0;
+		for (int pass = 0; pass < 10; ++pass)
+			for (typename Map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+				sum += it->second;
+		g_sink += sum;
+		mp.clear();
+	}
+	news = g_news;
+	return ns_per_op(start, clock(), n);
+}
+
+void runAllocator(long max_n) {
+	std::cout << "\n===== fill + churn + 10 scans + clear, ns per element / operator new calls =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(16) << "ft std::alloc" << std::setw(16) << "ft pool_alloc"
+						<< std::setw(16) << "std::map" << std::endl;
+	for (long n = 1000; n <= max_n; n *= 10) {
+		long news[3];
+		srand(n);
+		double ft_std = benchChurn<ft::map<int, int> >(n, news[0]);
+		srand(n);
+		double ft_pool = benchChurn<ft::map<int, int, ft::less<int>,
+				ft::pool_allocator<ft::pair<const int, int> > > >(n, news[1]);
+		srand(n);
+		double std_std = benchChurn<std::map<int, int> >(n, news[2]);
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n << std::setw(16) << ft_std
+							<< std::setw(16) << ft_pool << std::setw(16) << std_std << std::endl;
+		std::cout << std::setw(10) << "new" << std::setw(16) << news[0] << std::setw(16) << news[1]
+							<< std::setw(16) << news[2] << std::endl;
+	}
+}
+
+// Sliding window: every step expires the oldest key and erases one random key in the middle.
+template <typename Map>
+double benchWindow(long n) {
+	Map mp;
+	for (long i = 0; i < n; ++i)
+		mp.insert(mp.end(), typename Map::value_type(static_cast<int>(i), 0));
+	clock_t start = clock();
+	long sum = 0;
+	for (long i = n; i < n + BENCH_QUERIES; ++i) {
+		mp.erase(mp.begin());
+		sum += mp.erase(static_cast<int>(i - n / 2 + rand() % 64));
+		mp.insert(mp.end(), typename Map::value_type(static_cast<int>(i), 0));
+		mp[static_cast<int>(i - n / 2 + rand() % 64)] = 1;
+	}
+	g_sink += sum;
+	return ns_per_op(start, clock(), BENCH_QUERIES);
+}
+
+void runWindow(long max_n) {
+	printHeader("sliding window: erase(begin()) + erase(key) + 2 inserts");
+	for (long n = 1000; n <= max_n; n *= 10) {
+		srand(n);
+		double ft_time = benchWindow<ft::map<int, int> >(n);
+		srand(n);
+		printRow(n, ft_time, benchWindow<std::map<int, int> >(n));
+	}
+}
+
+void runBounds(long max_n) {
+	printHeader("lower_bound + upper_bound + equal_range");
+	for (long n = 1000; n <= max_n; n *= 10) {
+		ft::map<int, int> ft_mp;
+		std::map<int, int> std_mp;
+		fillMap(ft_mp, n);
+		fillMap(std_mp, n);
+
+		std::vector<int> probes(BENCH_QUERIES);
+		for (size_t i = 0; i < probes.size(); ++i)
+			probes[i] = rand() % (2 * n);
+		printRow(n, benchBounds(ft_mp, probes), benchBounds(std_mp, probes));
+	}
+}
+
+int main(int argc, char** argv) {
+	long max_n = 1000000;
+	if (argc > 1)
+		max_n = atol(argv[1]);
+	srand(42);
+	std::cout << "################ Bench Map ################" << std::endl;
+	runFind(max_n);
+	runBounds(max_n);
+	runDuplicate(max_n);
+	runPopMin(max_n);
+	runCopy(max_n);
+	runBuild(max_n);
+	runAppend(max_n);
+	runAllocator(max_n);
+	runWindow(max_n);
+	runLargeValue(max_n);
+	runStringProbe(max_n);
+	runCompareCount(max_n);
+	return 0;
+}
@@ -1,4 +1,5 @@
 #include "map.hpp"
+#include "pool_allocator.hpp"
 #include <iostream>
 #include <string>
 #include <list>
@@ -8,11 +9,105 @@
 #define TESTED_NAMESPACE ft
 #endif
 
+#include "tested.hpp"
+
 #define T1 int
 #define T2 std::string
 #define T3 TESTED_NAMESPACE::map<T1, T2>::value_type
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::map<T1, T2>::size_type
 
+// Keeps the number of live allocations in a counter shared by its copies.
+template <typename T>
+class counting_allocator : public std::allocator<T> {
+public:
+	template <typename U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	long* live;
+
+	explicit counting_allocator(long* counter = NULL) : live(counter) {}
+	counting_allocator(const counting_allocator& x) : std::allocator<T>(x), live(x.live) {}
+	template <typename U>
+	counting_allocator(const counting_allocator<U>& x) : std::allocator<T>(), live(x.live) {}
+
+	T* allocate(size_t n, const void* hint = 0) {
+		if (live)
+			*live += n;
+		return std::allocator<T>::allocate(n, hint);
+	}
+	void deallocate(T* p, size_t n) {
+		if (live)
+			*live -= n;
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
+// std::less<> is C++14, the std reference output comes from std::less<std::string>,
+// which converts the const char* probes instead.
+#define TRANSPARENT_LESS_ft		ft::less<>
+#define TRANSPARENT_LESS_std	std::less<std::string>
+#define TRANSPARENT_LESS			TESTED(TRANSPARENT_LESS)
+
+// Only compares two std::string, a lookup that passes the probe through unconverted does not compile.
+struct StringOnlyLess {
+	bool operator()(const std::string& x, const std::string& y) const { return x < y; }
+
+private:
+	template <typename A, typename B>
+	bool operator()(const A&, const B&) const;
+};
+
+// std has no sorted_unique tag, the std reference output comes from the plain range overloads.
+#define SORTED_UNIQUE_ft	ft::sorted_unique,
+#define SORTED_UNIQUE_std
+#define SORTED_UNIQUE			TESTED(SORTED_UNIQUE)
+
+// std has no pool allocator, the std reference output comes from std::allocator.
+#define POOL_ALLOCATOR_ft(T)	ft::pool_allocator<T>
+#define POOL_ALLOCATOR_std(T)	std::allocator<T>
+#define POOL_ALLOCATOR(T)			TESTED(POOL_ALLOCATOR)(T)
+
+// Opts in to the three-way search of the trees, std only uses the call operator.
+// Orders by the last digit first, so the order differs from plain int order.
+struct LastDigitFirst {
+	typedef void is_three_way;
+
+	bool operator()(int x, int y) const { return compare(x, y) < 0; }
+	int compare(int x, int y) const {
+		if (x % 10 != y % 10)
+			return (x % 10 < y % 10) ? -1 : 1;
+		return (x < y) ? -1 : (y < x);
+	}
+};
+
+// Orders ascending or descending, chosen at construction.
+struct Direction {
+	bool reverse;
+
+	Direction(bool r = false) : reverse(r) {}
+	bool operator()(int x, int y) const { return reverse ? y < x : x < y; }
+};
+
+// Size, ends and sum of the keys and values, for maps too big to print.
+template <typename M>
+void printSummary(M const &mp) {
+	long sum = 0;
+	for (typename M::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		sum += it->first + static_cast<long>(it->second.size());
+	std::cout << "size: " << mp.size();
+	if (!mp.empty())
+		std::cout << " begin: " << mp.begin()->first << " last: " << (--mp.end())->first;
+	std::cout << " sum: " << sum << std::endl;
+}
+
+template <typename M>
+void printKeys(M const &mp) {
+	std::cout << "size: " << mp.size() << " content:";
+	for (typename M::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << " " << it->first << "=" << it->second;
+	std::cout << std::endl;
+}
+
 template <typename T>
 void printContainers(T const &mp, bool print_content = true) {
 	const T_SIZE_TYPE size = mp.size();
@@ -44,6 +139,13 @@ int main() {
 	TESTED_NAMESPACE::map<T1, T2> mp_range(lst.begin(), lst.end());
 	printContainers(mp_range);
 
+	std::cout << "range constructor (unsorted, duplicate keys): " << std::endl;
+	std::list<T3> lst_dup;
+	for (unsigned int i = 0; i < 20; ++i)
+		lst_dup.push_back(T3((i * 7) % 13, std::string(i + 1, i + 65)));
+	TESTED_NAMESPACE::map<T1, T2> mp_dup(lst_dup.begin(), lst_dup.end());
+	printContainers(mp_dup);
+
 	std::cout << "copy constructor: " << std::endl;
 	TESTED_NAMESPACE::map<T1, T2> mp_copy(mp_range);
 	printContainers(mp_copy);
@@ -86,6 +188,16 @@ int main() {
 	mp_ot.insert(TESTED_NAMESPACE::make_pair(21, "hell..."));
 	printContainers(mp_ot);
 
+	std::cout << "insert with hint (end, right, wrong): " << std::endl;
+	for (int i = 50; i < 55; ++i)
+		mp_ot.insert(mp_ot.end(), TESTED_NAMESPACE::make_pair(i, "end"));
+	mp_ot.insert(mp_ot.lower_bound(30), TESTED_NAMESPACE::make_pair(30, "right"));
+	mp_ot.insert(mp_ot.lower_bound(30), TESTED_NAMESPACE::make_pair(30, "again"));
+	mp_ot.insert(mp_ot.begin(), TESTED_NAMESPACE::make_pair(45, "wrong"));
+	mp_ot.insert(mp_ot.end(), TESTED_NAMESPACE::make_pair(0, "wrong"));
+	std::cout << "hint on the key: " << mp_ot.insert(mp_ot.find(52), TESTED_NAMESPACE::make_pair(52, "dup"))->second << std::endl;
+	printContainers(mp_ot);
+
 	std::cout << "+++ [] +++" << std::endl;
 	mp_ot[2] = "New";
 	printContainers(mp_ot);
@@ -119,6 +231,212 @@ int main() {
 	std::cout << "lower_bound: " << mp_ot.lower_bound(5)->first << std::endl;
 	std::cout << "upper_bound: " << mp_ot.upper_bound(5)->first << std::endl;
 	std::cout << "equal_range: " << mp_ot.equal_range(5).first->first << ", " << mp_ot.equal_range(5).second->first << std::endl;
+	std::cout << "lower_bound 0: " << mp_ot.lower_bound(0)->first << std::endl;
+	std::cout << "upper_bound 10 is end: " << ((mp_ot.upper_bound(10) == mp_ot.end()) ? "OK" : "KO") << std::endl;
+	std::cout << "equal_range 42 is empty: " << ((mp_ot.equal_range(42).first == mp_ot.equal_range(42).second) ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== sorted unique range =====" << std::endl;
+	const int sorted_sizes[7] = { 0, 1, 2, 3, 7, 8, 100 };
+	for (int i = 0; i < 7; ++i) {
+		std::list<T3> lst_sorted;
+		for (int k = 0; k < sorted_sizes[i]; ++k)
+			lst_sorted.push_back(T3(k * 2, std::string(1, 'a' + k % 26)));
+		TESTED_NAMESPACE::map<T1, T2> mp_sorted(SORTED_UNIQUE lst_sorted.begin(), lst_sorted.end());
+		bool in_order = true;
+		for (TESTED_NAMESPACE::map<T1, T2>::iterator it = mp_sorted.begin(); it != mp_sorted.end(); ++it) {
+			TESTED_NAMESPACE::map<T1, T2>::iterator next = it;
+			if (++next != mp_sorted.end() && !(it->first < next->first))
+				in_order = false;
+		}
+		std::cout << "size: " << mp_sorted.size() << " in order: " << (in_order ? "OK" : "KO");
+		if (!mp_sorted.empty())
+			std::cout << " begin: " << mp_sorted.begin()->first << " last: " << (--mp_sorted.end())->first;
+		std::cout << std::endl;
+		mp_sorted.insert(TESTED_NAMESPACE::make_pair(-1, "front"));
+		mp_sorted.insert(TESTED_NAMESPACE::make_pair(sorted_sizes[i], "middle"));
+		mp_sorted.insert(TESTED_NAMESPACE::make_pair(1000, "back"));
+		mp_sorted.insert(TESTED_NAMESPACE::make_pair(0, "duplicate"));
+		mp_sorted.erase(2);
+		printContainers(mp_sorted, sorted_sizes[i] < 10);
+	}
+	std::list<T3> lst_tail;
+	for (int k = 0; k < 5; ++k)
+		lst_tail.push_back(T3(k * 3, "tail"));
+	TESTED_NAMESPACE::map<T1, T2> mp_sorted_insert;
+	mp_sorted_insert.insert(SORTED_UNIQUE lst_tail.begin(), lst_tail.end());
+	printContainers(mp_sorted_insert);
+	lst_tail.clear();
+	for (int k = 0; k < 5; ++k)
+		lst_tail.push_back(T3(k * 2, "more"));
+	mp_sorted_insert.insert(SORTED_UNIQUE lst_tail.begin(), lst_tail.end());
+	printContainers(mp_sorted_insert);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== heterogeneous lookup =====" << std::endl;
+	typedef TESTED_NAMESPACE::map<std::string, T1, TRANSPARENT_LESS> name_map;
+	name_map mp_names;
+	const char* names[6] = { "kiwi", "apple", "fig", "pear", "banana", "cherry" };
+	for (int i = 0; i < 6; ++i)
+		mp_names[names[i]] = i;
+	const name_map& mp_names_ref = mp_names;
+	std::cout << "find fig: " << mp_names.find("fig")->second << " const: " << mp_names_ref.find("fig")->second << std::endl;
+	std::cout << "find grape is end: " << ((mp_names.find("grape") == mp_names.end()) ? "OK" : "KO") << std::endl;
+	std::cout << "count pear: " << mp_names.count("pear") << " count plum: " << mp_names.count("plum") << std::endl;
+	std::cout << "lower_bound c: " << mp_names.lower_bound("c")->first << " const: " << mp_names_ref.lower_bound("c")->first << std::endl;
+	std::cout << "upper_bound fig: " << mp_names.upper_bound("fig")->first << " const: " << mp_names_ref.upper_bound("fig")->first << std::endl;
+	std::cout << "equal_range kiwi: " << mp_names.equal_range("kiwi").first->first << ", " << mp_names.equal_range("kiwi").second->first << std::endl;
+	std::cout << "equal_range grape is empty: "
+						<< ((mp_names_ref.equal_range("grape").first == mp_names_ref.equal_range("grape").second) ? "OK" : "KO") << std::endl;
+	std::cout << "upper_bound z is end: " << ((mp_names.upper_bound("z") == mp_names.end()) ? "OK" : "KO") << std::endl;
+	TESTED_NAMESPACE::map<std::string, T1, StringOnlyLess> mp_strict;
+	for (int i = 0; i < 6; ++i)
+		mp_strict[names[i]] = i;
+	std::cout << "non-transparent find: " << mp_strict.find("banana")->second << " count: " << mp_strict.count("plum")
+						<< " lower_bound: " << mp_strict.lower_bound("d")->first << " upper_bound: " << mp_strict.upper_bound("d")->first
+						<< " equal_range: " << mp_strict.equal_range("apple").first->first << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== three-way comparator =====" << std::endl;
+	typedef TESTED_NAMESPACE::map<T1, T1, LastDigitFirst> digit_map;
+	digit_map mp_digit;
+	int inserted = 0;
+	for (int i = 0; i < 300; ++i)
+		inserted += mp_digit.insert(TESTED_NAMESPACE::make_pair((i * 37) % 211, i)).second;
+	for (int i = 0; i < 20; ++i)
+		mp_digit.insert(mp_digit.lower_bound(i * 11), TESTED_NAMESPACE::make_pair(i * 11, -i));
+	std::cout << "inserted: " << inserted << " size: " << mp_digit.size() << std::endl;
+	int erased = 0;
+	for (int i = 0; i < 211; i += 4)
+		erased += mp_digit.erase(i);
+	mp_digit.erase(mp_digit.find(21));
+	std::cout << "erased: " << erased << " size: " << mp_digit.size() << std::endl;
+	std::cout << "first: " << mp_digit.begin()->first << " last: " << (--mp_digit.end())->first << std::endl;
+	for (int k = 0; k < 230; k += 23) {
+		digit_map::iterator found = mp_digit.find(k);
+		std::cout << "key " << k << ": find " << ((found == mp_digit.end()) ? -1 : found->second)
+							<< " count " << mp_digit.count(k)
+							<< " lower_bound " << ((mp_digit.lower_bound(k) == mp_digit.end()) ? -1 : mp_digit.lower_bound(k)->first)
+							<< " upper_bound " << ((mp_digit.upper_bound(k) == mp_digit.end()) ? -1 : mp_digit.upper_bound(k)->first)
+							<< " equal_range " << TESTED_NAMESPACE::distance(mp_digit.equal_range(k).first, mp_digit.equal_range(k).second) << std::endl;
+	}
+	int digit_order = 0;
+	for (digit_map::iterator it = mp_digit.begin(); it != mp_digit.end() && digit_order < 15; ++it, ++digit_order)
+		std::cout << it->first << " ";
+	std::cout << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== stateful comparator =====" << std::endl;
+	typedef TESTED_NAMESPACE::map<T1, T1, Direction> dir_map;
+	dir_map mp_up((Direction(false)));
+	dir_map mp_down((Direction(true)));
+	mp_up[1] = 1;
+	mp_up[2] = 2;
+	mp_down[10] = 1;
+	mp_down[3] = 2;
+	mp_up.swap(mp_down);
+	mp_up[5] = 7;
+	mp_down[0] = 3;
+	printKeys(mp_up);
+	printKeys(mp_down);
+	std::cout << "key_comp after swap: " << mp_up.key_comp()(10, 3) << " " << mp_down.key_comp()(10, 3) << std::endl;
+	std::cout << "value_comp after swap: " << mp_up.value_comp()(*mp_up.begin(), *(--mp_up.end())) << std::endl;
+	dir_map mp_assigned((Direction(false)));
+	mp_assigned[8] = 8;
+	mp_assigned = mp_up;
+	mp_assigned[4] = 9;
+	mp_assigned[10] = 0;
+	printKeys(mp_assigned);
+	dir_map mp_dir_copy(mp_assigned);
+	mp_dir_copy[6] = 6;
+	printKeys(mp_dir_copy);
+	std::cout << "find 6: " << mp_dir_copy.find(6)->second << " lower_bound 7: " << mp_dir_copy.lower_bound(7)->first << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== allocator =====" << std::endl;
+	long live = 0;
+	{
+		typedef TESTED_NAMESPACE::map<T1, T2, TESTED_NAMESPACE::less<T1>, counting_allocator<T3> > counted_map;
+		counted_map mp_alloc((TESTED_NAMESPACE::less<T1>()), counting_allocator<T3>(&live));
+		for (int i = 0; i < 10; ++i)
+			mp_alloc[i] = "alloc";
+		std::cout << "nodes from the given allocator: " << ((live > 0) ? "OK" : "KO") << std::endl;
+		long before_copy = live;
+		counted_map mp_alloc_copy(mp_alloc);
+		std::cout << "copy uses it too: " << ((live > before_copy) ? "OK" : "KO") << std::endl;
+	}
+	std::cout << "everything freed: " << ((live == 0) ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== pool allocator =====" << std::endl;
+	typedef TESTED_NAMESPACE::pair<const T1, T1>	int_pair;
+	typedef TESTED_NAMESPACE::map<T1, T1, TESTED_NAMESPACE::less<T1>, POOL_ALLOCATOR(int_pair) > pool_map;
+	typedef TESTED_NAMESPACE::map<T1, T2>::value_type	string_pair;
+	typedef TESTED_NAMESPACE::map<T1, T2, TESTED_NAMESPACE::less<T1>, POOL_ALLOCATOR(string_pair) > pool_string_map;
+	POOL_ALLOCATOR(int_pair) pool_alloc;
+	{
+		// Copies share the pool, so it cannot be released while one of them is alive.
+		POOL_ALLOCATOR(int_pair) pool_alloc_copy(pool_alloc);
+		int_pair* p = pool_alloc.allocate(1);
+		pool_alloc_copy.deallocate(p, 1);
+		std::cout << "copy compares equal: " << ((pool_alloc == pool_alloc_copy) ? "OK" : "KO") << std::endl;
+		// A rebound copy shares the arena too, so rebinding back gives an equal allocator.
+		POOL_ALLOCATOR(T1) pool_alloc_rebound(pool_alloc);
+		std::cout << "rebound compares equal: " << ((POOL_ALLOCATOR(int_pair)(pool_alloc_rebound) == pool_alloc) ? "OK" : "KO") << std::endl;
+		std::cout << "release while shared: " << ft::release_all<POOL_ALLOCATOR(int_pair) >::release(pool_alloc) << std::endl;
+	}
+	// Two maps given the same allocator share its node pool, they free their nodes one by one.
+	pool_map mp_pool((TESTED_NAMESPACE::less<T1>()), pool_alloc);
+	pool_map mp_pool_other((TESTED_NAMESPACE::less<T1>()), pool_alloc);
+	for (int i = 0; i < 600; ++i) {
+		mp_pool[i] = i;
+		mp_pool_other[i * 2] = i;
+	}
+	for (int i = 0; i < 600; i += 3)
+		mp_pool.erase(i);
+	std::cout << "size: " << mp_pool.size() << " begin: " << mp_pool.begin()->first << " last: " << (--mp_pool.end())->first << std::endl;
+	mp_pool.clear();
+	std::cout << "after clear: " << mp_pool.size() << " empty: " << ((mp_pool.begin() == mp_pool.end()) ? "OK" : "KO") << std::endl;
+	for (int i = 300; i > 0; --i)
+		mp_pool[i * 5] = i;
+	std::cout << "reinsert: " << mp_pool.size() << " begin: " << mp_pool.begin()->first << " last: " << (--mp_pool.end())->first << std::endl;
+	std::cout << "other map kept: " << mp_pool_other.size() << " find 598: " << mp_pool_other.find(598)->second << std::endl;
+	{
+		pool_map mp_pool_copy(mp_pool);
+		mp_pool_copy[1] = 1;
+		mp_pool_copy.clear();
+		mp_pool_copy[2] = 2;
+		pool_map mp_pool_assigned;
+		mp_pool_assigned[3] = 3;
+		mp_pool_assigned = mp_pool;
+		mp_pool_assigned.erase(5);
+		mp_pool_assigned.swap(mp_pool_copy);
+		std::cout << "copy: " << mp_pool_copy.size() << " begin: " << mp_pool_copy.begin()->first << std::endl;
+		std::cout << "assigned: " << mp_pool_assigned.size() << " begin: " << mp_pool_assigned.begin()->first << std::endl;
+		mp_pool_other.swap(mp_pool_assigned);
+		mp_pool_other[7] = 7;
+	}
+	// The copies are gone, the original still owns its nodes.
+	std::cout << "original: " << mp_pool.size() << " begin: " << mp_pool.begin()->first << " last: " << (--mp_pool.end())->first << std::endl;
+	for (int i = 0; i < 10; ++i)
+		mp_pool[i] = i;
+	std::cout << "original after insert: " << mp_pool.size() << " find 1500: " << mp_pool.find(1500)->second << std::endl;
+	std::cout << "swapped in: " << mp_pool_other.size() << " begin: " << mp_pool_other.begin()->first << std::endl;
+
+	// Values with a destructor are destroyed one by one instead of releasing the pool.
+	pool_string_map mp_pool_strings;
+	for (int i = 0; i < 300; ++i)
+		mp_pool_strings[i] = std::string(i % 40, 'p');
+	pool_string_map mp_pool_strings_copy(mp_pool_strings);
+	mp_pool_strings.clear();
+	for (int i = 0; i < 50; ++i)
+		mp_pool_strings[i * 3] = "again";
+	printSummary(mp_pool_strings);
+	printSummary(mp_pool_strings_copy);
+	mp_pool_strings = mp_pool_strings_copy;
+	mp_pool_strings_copy.swap(mp_pool_strings);
+	mp_pool_strings_copy.clear();
+	printSummary(mp_pool_strings);
 
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== relational operators =====" << std::endl;
@@ -1,4 +1,5 @@
 #include "set.hpp"
+#include "pool_allocator.hpp"
 #include <iostream>
 #include <string>
 #include <list>
@@ -8,10 +9,44 @@
 #define TESTED_NAMESPACE ft
 #endif
 
+#include "tested.hpp"
+
 #define T1 int
 #define T3 TESTED_NAMESPACE::set<T1>::value_type
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::set<T1>::size_type
 
+// std::less<> is C++14, the std reference output comes from std::less<std::string>,
+// which converts the const char* probes instead.
+#define TRANSPARENT_LESS_ft		ft::less<>
+#define TRANSPARENT_LESS_std	std::less<std::string>
+#define TRANSPARENT_LESS			TESTED(TRANSPARENT_LESS)
+
+// std has no sorted_unique tag, the std reference output comes from the plain range overloads.
+#define SORTED_UNIQUE_ft	ft::sorted_unique,
+#define SORTED_UNIQUE_std
+#define SORTED_UNIQUE			TESTED(SORTED_UNIQUE)
+
+// std has no pool allocator, the std reference output comes from std::allocator.
+#define POOL_ALLOCATOR_ft(T)	ft::pool_allocator<T>
+#define POOL_ALLOCATOR_std(T)	std::allocator<T>
+#define POOL_ALLOCATOR(T)			TESTED(POOL_ALLOCATOR)(T)
+
+// Orders ascending or descending, chosen at construction.
+struct Direction {
+	bool reverse;
+
+	Direction(bool r = false) : reverse(r) {}
+	bool operator()(int x, int y) const { return reverse ? y < x : x < y; }
+};
+
+template <typename S>
+void printKeys(S const &st) {
+	std::cout << "size: " << st.size() << " content:";
+	for (typename S::const_iterator it = st.begin(); it != st.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
 template <typename T>
 void printContainers(T const &st, bool print_content = true) {
 	const T_SIZE_TYPE size = st.size();
@@ -43,6 +78,13 @@ int main() {
 	TESTED_NAMESPACE::set<T1> st_range(lst.begin(), lst.end());
 	printContainers(st_range);
 
+	std::cout << "range constructor (unsorted, duplicate keys): " << std::endl;
+	std::list<T3> lst_dup;
+	for (unsigned int i = 0; i < 20; ++i)
+		lst_dup.push_back(T3((i * 7) % 13));
+	TESTED_NAMESPACE::set<T1> st_dup(lst_dup.begin(), lst_dup.end());
+	printContainers(st_dup);
+
 	std::cout << "copy constructor: " << std::endl;
 	TESTED_NAMESPACE::set<T1> st_copy(st_range);
 	printContainers(st_copy);
@@ -108,6 +150,117 @@ int main() {
 	std::cout << "count 5: " << st_ot.count(5) << std::endl;
 	std::cout << "count 20: " << st_ot.count(20) << std::endl;
 
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== lower_bound | upper_bound | equal_range =====" << std::endl;
+	std::cout << "lower_bound: " << *st_ot.lower_bound(5) << std::endl;
+	std::cout << "upper_bound: " << *st_ot.upper_bound(5) << std::endl;
+	std::cout << "equal_range: " << *st_ot.equal_range(5).first << ", " << *st_ot.equal_range(5).second << std::endl;
+	std::cout << "upper_bound 10 is end: " << ((st_ot.upper_bound(10) == st_ot.end()) ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== sorted unique range =====" << std::endl;
+	const int sorted_sizes[7] = { 0, 1, 2, 3, 7, 8, 100 };
+	for (int i = 0; i < 7; ++i) {
+		std::list<T3> lst_sorted;
+		for (int k = 0; k < sorted_sizes[i]; ++k)
+			lst_sorted.push_back(k * 2);
+		TESTED_NAMESPACE::set<T1> st_sorted(SORTED_UNIQUE lst_sorted.begin(), lst_sorted.end());
+		bool in_order = true;
+		for (TESTED_NAMESPACE::set<T1>::iterator it = st_sorted.begin(); it != st_sorted.end(); ++it) {
+			TESTED_NAMESPACE::set<T1>::iterator next = it;
+			if (++next != st_sorted.end() && !(*it < *next))
+				in_order = false;
+		}
+		std::cout << "size: " << st_sorted.size() << " in order: " << (in_order ? "OK" : "KO");
+		if (!st_sorted.empty())
+			std::cout << " begin: " << *st_sorted.begin() << " last: " << *(--st_sorted.end());
+		std::cout << std::endl;
+		st_sorted.insert(-1);
+		st_sorted.insert(sorted_sizes[i]);
+		st_sorted.insert(1000);
+		st_sorted.insert(0);
+		st_sorted.erase(2);
+		printContainers(st_sorted, sorted_sizes[i] < 10);
+	}
+	std::list<T3> lst_tail;
+	for (int k = 0; k < 5; ++k)
+		lst_tail.push_back(k * 3);
+	TESTED_NAMESPACE::set<T1> st_sorted_insert;
+	st_sorted_insert.insert(SORTED_UNIQUE lst_tail.begin(), lst_tail.end());
+	printContainers(st_sorted_insert);
+	lst_tail.clear();
+	for (int k = 0; k < 5; ++k)
+		lst_tail.push_back(k * 2);
+	st_sorted_insert.insert(SORTED_UNIQUE lst_tail.begin(), lst_tail.end());
+	printContainers(st_sorted_insert);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== heterogeneous lookup =====" << std::endl;
+	const char* names[6] = { "kiwi", "apple", "fig", "pear", "banana", "cherry" };
+	TESTED_NAMESPACE::set<std::string, TRANSPARENT_LESS> st_names(names, names + 6);
+	std::cout << "find fig: " << *st_names.find("fig") << std::endl;
+	std::cout << "find grape is end: " << ((st_names.find("grape") == st_names.end()) ? "OK" : "KO") << std::endl;
+	std::cout << "count pear: " << st_names.count("pear") << " count plum: " << st_names.count("plum") << std::endl;
+	std::cout << "lower_bound c: " << *st_names.lower_bound("c") << " upper_bound fig: " << *st_names.upper_bound("fig") << std::endl;
+	std::cout << "equal_range kiwi: " << *st_names.equal_range("kiwi").first << ", " << *st_names.equal_range("kiwi").second << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== stateful comparator =====" << std::endl;
+	typedef TESTED_NAMESPACE::set<T1, Direction> dir_set;
+	dir_set st_up((Direction(false)));
+	dir_set st_down((Direction(true)));
+	st_up.insert(1);
+	st_up.insert(2);
+	st_down.insert(10);
+	st_down.insert(3);
+	st_up.swap(st_down);
+	st_up.insert(5);
+	st_down.insert(0);
+	printKeys(st_up);
+	printKeys(st_down);
+	std::cout << "key_comp after swap: " << st_up.key_comp()(10, 3) << " " << st_down.key_comp()(10, 3) << std::endl;
+	std::cout << "value_comp after swap: " << st_up.value_comp()(10, 3) << std::endl;
+	dir_set st_assigned((Direction(false)));
+	st_assigned.insert(8);
+	st_assigned = st_up;
+	st_assigned.insert(4);
+	printKeys(st_assigned);
+	std::cout << "count 4: " << st_assigned.count(4) << " upper_bound 5: " << *st_assigned.upper_bound(5) << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== pool allocator =====" << std::endl;
+	typedef TESTED_NAMESPACE::set<T1, TESTED_NAMESPACE::less<T1>, POOL_ALLOCATOR(T1) > pool_set;
+	typedef TESTED_NAMESPACE::set<std::string, TESTED_NAMESPACE::less<std::string>, POOL_ALLOCATOR(std::string) > pool_string_set;
+	pool_set st_pool;
+	for (int i = 0; i < 600; ++i)
+		st_pool.insert(i);
+	st_pool.clear();
+	for (int i = 300; i > 0; --i)
+		st_pool.insert(i * 5);
+	std::cout << "reinsert: " << st_pool.size() << " begin: " << *st_pool.begin() << " last: " << *(--st_pool.end()) << std::endl;
+	{
+		pool_set st_pool_copy(st_pool);
+		st_pool_copy.clear();
+		st_pool_copy.insert(2);
+		pool_set st_pool_assigned;
+		st_pool_assigned.insert(3);
+		st_pool_assigned = st_pool;
+		st_pool_assigned.swap(st_pool_copy);
+		std::cout << "copy: " << st_pool_copy.size() << " assigned: " << st_pool_assigned.size() << std::endl;
+	}
+	// The copies are gone, the original still owns its nodes.
+	st_pool.insert(1);
+	std::cout << "original: " << st_pool.size() << " begin: " << *st_pool.begin() << " last: " << *(--st_pool.end()) << std::endl;
+	pool_string_set st_pool_strings;
+	for (int i = 0; i < 300; ++i)
+		st_pool_strings.insert(std::string(i % 40, 'a' + i % 26));
+	pool_string_set st_pool_strings_copy(st_pool_strings);
+	st_pool_strings.clear();
+	st_pool_strings.insert("again");
+	st_pool_strings.swap(st_pool_strings_copy);
+	std::cout << "strings: " << st_pool_strings.size() << " " << st_pool_strings_copy.size()
+						<< " last: " << *(--st_pool_strings.end()) << std::endl;
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== relational operators =====" << std::endl;
 	lst_size = 7;
@@ -0,0 +1,244 @@
+#include "small_vector.hpp"
+#include "stack.hpp"
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <stack>
+#include <string>
+#include <vector>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+#include "tested.hpp"
+
+// std has no small_vector, the reference output comes from std::vector.
+#define SMALL_VECTOR_ft(T, N)		ft::small_vector<T, N>
+#define SMALL_VECTOR_std(T, N)	std::vector<T>
+#define SMALL_VECTOR(T, N)			TESTED(SMALL_VECTOR)(T, N)
+
+typedef SMALL_VECTOR(int, 4)					int_vector;
+typedef SMALL_VECTOR(std::string, 4)	string_vector;
+
+// std::vector has no emplace in C++98, its reference output comes from push_back and insert.
+template <typename T, size_t N, typename A1>
+void emplaceBack(ft::small_vector<T, N>& vec, const A1& a1) { vec.emplace_back(a1); }
+template <typename T, typename A1>
+void emplaceBack(std::vector<T>& vec, const A1& a1) { vec.push_back(T(a1)); }
+template <typename T, size_t N, typename A1, typename A2>
+void emplaceBack(ft::small_vector<T, N>& vec, const A1& a1, const A2& a2) { vec.emplace_back(a1, a2); }
+template <typename T, typename A1, typename A2>
+void emplaceBack(std::vector<T>& vec, const A1& a1, const A2& a2) { vec.push_back(T(a1, a2)); }
+
+template <typename T, size_t N, typename A1, typename A2>
+typename ft::small_vector<T, N>::iterator emplaceAt(ft::small_vector<T, N>& vec, typename ft::small_vector<T, N>::iterator pos,
+																										const A1& a1, const A2& a2) {
+	return vec.emplace(pos, a1, a2);
+}
+template <typename T, typename A1, typename A2>
+typename std::vector<T>::iterator emplaceAt(std::vector<T>& vec, typename std::vector<T>::iterator pos,
+																						const A1& a1, const A2& a2) {
+	return vec.insert(pos, T(a1, a2));
+}
+
+// resize_uninitialized is an ft extension, std::vector value-initializes with resize.
+template <typename T, size_t N>
+void resizeUninitialized(ft::small_vector<T, N>& vec, size_t n) { vec.resize_uninitialized(n); }
+template <typename T>
+void resizeUninitialized(std::vector<T>& vec, size_t n) { vec.resize(n); }
+
+template <typename V>
+void printContainers(V const &vec, bool print_content = true) {
+	const std::string isCapacityOK = (vec.capacity() >= vec.size()) ? "OK" : "KO";
+
+	std::cout << "size: " << vec.size() << std::endl;
+	std::cout << "capacity: " << isCapacityOK << std::endl;
+	if (print_content) {
+		typename V::const_iterator it = vec.begin();
+		typename V::const_iterator ite = vec.end();
+		std::cout << std::endl << "Content is: " << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << *it << std::endl;
+	}
+	std::cout << "------------------------" << std::endl;
+}
+
+template <typename V>
+void printReverse(V const &vec) {
+	typename V::const_reverse_iterator it = vec.rbegin();
+	std::cout << "reverse:";
+	for (; it != vec.rend(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
+template <typename V>
+void testModifiers(typename V::value_type const *values) {
+	std::cout << "===== default | fill | range | copy constructor =====" << std::endl;
+	V v_default;
+	V v_fill_inline(3, values[0]);
+	V v_fill_heap(9, values[1]);
+	V v_range(values, values + 6);
+	V v_copy(v_range);
+	printContainers(v_default);
+	printContainers(v_fill_inline);
+	printContainers(v_fill_heap);
+	printContainers(v_range);
+	printContainers(v_copy);
+	printReverse(v_copy);
+
+	std::cout << "===== push_back past the inline capacity =====" << std::endl;
+	V v_push;
+	for (int i = 0; i < 10; ++i) {
+		v_push.push_back(values[i]);
+		if (i == 3 || i == 4 || i == 9)
+			printContainers(v_push);
+	}
+	v_push.push_back(v_push[2]);
+	v_push.pop_back();
+	v_push.pop_back();
+	printContainers(v_push);
+
+	std::cout << "===== insert | erase =====" << std::endl;
+	V v_insert(values, values + 2);
+	v_insert.insert(v_insert.begin() + 1, values[5]);
+	printContainers(v_insert);
+	v_insert.insert(v_insert.begin(), 2, v_insert[2]);
+	printContainers(v_insert);
+	std::list<typename V::value_type> l_insert(values + 6, values + 9);
+	v_insert.insert(v_insert.begin() + 3, l_insert.begin(), l_insert.end());
+	printContainers(v_insert);
+	v_insert.insert(v_insert.end() - 1, values, values + 3);
+	printContainers(v_insert);
+	v_insert.insert(v_insert.begin() + 1, values + 7, values + 8);
+	printContainers(v_insert);
+	std::cout << "*erase: " << *v_insert.erase(v_insert.begin() + 2) << std::endl;
+	v_insert.erase(v_insert.begin() + 1, v_insert.end() - 2);
+	printContainers(v_insert);
+	v_insert.erase(v_insert.begin(), v_insert.end());
+	printContainers(v_insert);
+
+	std::cout << "===== assign | resize | reserve | at =====" << std::endl;
+	V v_assign;
+	v_assign.assign(values + 1, values + 4);
+	printContainers(v_assign);
+	v_assign.assign(7, values[3]);
+	printContainers(v_assign);
+	v_assign.resize(2);
+	printContainers(v_assign);
+	v_assign.resize(5, values[8]);
+	printContainers(v_assign);
+	v_assign.reserve(50);
+	printContainers(v_assign);
+	try {
+		v_assign.at(5);
+	}
+	catch (std::out_of_range&) {
+		std::cout << "at: out_of_range" << std::endl;
+	}
+	std::cout << "at: " << v_assign.at(4) << " front: " << v_assign.front() << " back: " << v_assign.back() << std::endl;
+	v_assign = v_fill_inline;
+	printContainers(v_assign);
+	v_fill_inline = v_fill_heap;
+	printContainers(v_fill_inline);
+
+	std::cout << "===== swap =====" << std::endl;
+	V v_swap_small(values, values + 2);
+	V v_swap_small2(values + 2, values + 5);
+	V v_swap_big(values, values + 8);
+	V v_swap_big2(values + 3, values + 10);
+	v_swap_small.swap(v_swap_small2);
+	printContainers(v_swap_small);
+	printContainers(v_swap_small2);
+	v_swap_small.swap(v_swap_big);
+	printContainers(v_swap_small);
+	printContainers(v_swap_big);
+	TESTED_NAMESPACE::swap(v_swap_small, v_swap_big2);
+	printContainers(v_swap_small);
+	printContainers(v_swap_big2);
+
+	std::cout << "===== relational operators =====" << std::endl;
+	V v_lhs(values, values + 5);
+	V v_rhs(v_lhs);
+	std::cout << "operator==: " << ((v_lhs == v_rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator!=: " << ((v_lhs != v_rhs) ? "OK" : "KO") << std::endl;
+	v_rhs.pop_back();
+	std::cout << "operator<:  " << ((v_lhs < v_rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator<=: " << ((v_lhs <= v_rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator>:  " << ((v_lhs > v_rhs) ? "OK" : "KO") << std::endl;
+	std::cout << "operator>=: " << ((v_lhs >= v_rhs) ? "OK" : "KO") << std::endl;
+}
+
+int main() {
+	std::cout << "################ Test Small Vector ################" << std::endl;
+
+	const int ints[10] = { 3, 14, 15, 92, 65, 35, 89, 79, 32, 38 };
+	const std::string strings[10] = { "zero", "one", "two", "three", "four", "five",
+																		"a string too long for the small string buffer", "seven", "eight", "nine" };
+
+	std::cout << "\n################ int ################" << std::endl;
+	testModifiers<int_vector>(ints);
+	std::cout << "\n################ std::string ################" << std::endl;
+	testModifiers<string_vector>(strings);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== single-pass input iterators =====" << std::endl;
+	std::istringstream in_range("1 2 3 4 5 6");
+	int_vector v_stream((std::istream_iterator<int>(in_range)), std::istream_iterator<int>());
+	printContainers(v_stream);
+	std::istringstream in_insert("-1 -2");
+	v_stream.insert(v_stream.begin() + 1, std::istream_iterator<int>(in_insert), std::istream_iterator<int>());
+	printContainers(v_stream);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== emplace_back | emplace =====" << std::endl;
+	string_vector v_emplace;
+	for (size_t i = 1; i < 4; ++i)
+		emplaceBack(v_emplace, i, 'a' + i);
+	emplaceBack(v_emplace, v_emplace[1]);
+	printContainers(v_emplace);
+	// The vector is full, the argument is an element that moves to the heap.
+	std::cout << "*emplace: " << *emplaceAt(v_emplace, v_emplace.begin(), v_emplace[2].c_str(), 2) << std::endl;
+	std::cout << "*emplace: " << *emplaceAt(v_emplace, v_emplace.begin() + 3, v_emplace.back().c_str(), 1) << std::endl;
+	std::cout << "*emplace: " << *emplaceAt(v_emplace, v_emplace.end(), 5, 'z') << std::endl;
+	printContainers(v_emplace);
+	int_vector v_emplace_int;
+	for (int i = 0; i < 8; ++i)
+		emplaceBack(v_emplace_int, ints[i]);
+	emplaceBack(v_emplace_int, v_emplace_int[0]);
+	printContainers(v_emplace_int);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== resize_uninitialized =====" << std::endl;
+	int_vector v_read(2, 1);
+	resizeUninitialized(v_read, 3);
+	v_read[2] = 7;
+	printContainers(v_read);
+	resizeUninitialized(v_read, 12);
+	for (size_t i = 3; i < v_read.size(); ++i)
+		v_read[i] = int(i);
+	printContainers(v_read);
+	resizeUninitialized(v_read, 1);
+	printContainers(v_read);
+	string_vector v_read_strings(1, "kept");
+	resizeUninitialized(v_read_strings, 6);
+	printContainers(v_read_strings);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== stack on small_vector =====" << std::endl;
+	TESTED_NAMESPACE::stack<int, int_vector> st;
+	for (int i = 0; i < 6; ++i)
+		st.push(ints[i]);
+	TESTED_NAMESPACE::stack<int, int_vector> st_copy(st);
+	std::cout << "size: " << st.size() << " top: " << st.top() << std::endl;
+	std::cout << "operator==: " << ((st == st_copy) ? "OK" : "KO") << std::endl;
+	st.pop();
+	std::cout << "operator<:  " << ((st < st_copy) ? "OK" : "KO") << std::endl;
+	while (!st.empty()) {
+		std::cout << "- " << st.top() << std::endl;
+		st.pop();
+	}
+	return 0;
+}
@@ -0,0 +1,16 @@
+#ifndef TESTED_HPP
+#define TESTED_HPP
+
+/**
+ * @brief TESTED
+ * Picks the ft or the std version of a test helper, NAME_ft or NAME_std, after TESTED_NAMESPACE.
+ * ft extensions that std lacks define both and the std one gives the reference output, e.g.
+ *		#define SORTED_UNIQUE_ft	ft::sorted_unique,
+ *		#define SORTED_UNIQUE_std
+ *		#define SORTED_UNIQUE			TESTED(SORTED_UNIQUE)
+ */
+#define TESTED_CAT(NAME, NS)		NAME##_##NS
+#define TESTED_EXPAND(NAME, NS)	TESTED_CAT(NAME, NS)
+#define TESTED(NAME)						TESTED_EXPAND(NAME, TESTED_NAMESPACE)
+
+#endif
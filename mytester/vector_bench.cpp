@@ -0,0 +1,649 @@
+#include "vector.hpp"
+#include "small_vector.hpp"
+#include "mmap_allocator.hpp"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <ctime>
+#include <cstdlib>
+#ifdef __linux__
+# include <sys/resource.h>
+# include <sys/wait.h>
+# include <unistd.h>
+#endif
+
+/**
+ * @brief vector benchmark
+ * Runs the same workload on ft::vector with each growth policy and on std::vector,
+ * through an allocator that counts the allocations and the bytes still allocated.
+ * The optional argument scales the biggest container size (default: 1000000).
+ */
+
+#define EXACT_MAX_N 10000	// exact_growth copies everything on each growth, it is quadratic.
+
+static volatile long g_sink = 0;	// Keeps the optimizer from dropping the measured loops.
+static long g_allocs = 0;					// Number of allocate calls.
+static long g_live = 0;						// Bytes allocated and not deallocated yet.
+
+template <typename T>
+class CountingAllocator : public std::allocator<T> {
+public:
+	template <typename U>
+	struct rebind { typedef CountingAllocator<U> other; };
+
+	CountingAllocator() {}
+	template <typename U>
+	CountingAllocator(const CountingAllocator<U>&) {}
+
+	T* allocate(size_t n, const void* hint = 0) {
+		++g_allocs;
+		g_live += n * sizeof(T);
+		return std::allocator<T>::allocate(n, hint);
+	}
+	void deallocate(T* p, size_t n) {
+		g_live -= n * sizeof(T);
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
+typedef ft::vector<int, CountingAllocator<int>, ft::double_growth>	FtDouble;
+typedef ft::vector<int, CountingAllocator<int>, ft::half_growth>		FtHalf;
+typedef ft::vector<int, CountingAllocator<int>, ft::exact_growth>		FtExact;
+typedef std::vector<int, CountingAllocator<int> >										Std;
+
+double ns_per_op(clock_t start, clock_t end, long ops) {
+	return static_cast<double>(end - start) * 1e9 / CLOCKS_PER_SEC / ops;
+}
+
+void printHeader(const std::string& title) {
+	std::cout << "\n===== " << title << " =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "ft double" << std::setw(14) << "ft 1.5x"
+						<< std::setw(14) << "ft exact" << std::setw(14) << "std" << std::endl;
+}
+
+// A workload returns its time per operation, allocs and leaked get the allocation count and the bytes left.
+struct Result {
+	double	time;
+	long		allocs;
+	long		leaked;
+};
+
+// A negative time marks a skipped run, printed as "-".
+void printCell(const Result& res, double value) {
+	if (res.time < 0)
+		std::cout << std::setw(14) << "-";
+	else
+		std::cout << std::setw(14) << value;
+}
+
+void printRows(long n, const Result* res) {
+	std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n;
+	for (int i = 0; i < 4; ++i)
+		printCell(res[i], res[i].time);
+	std::cout << std::setprecision(0) << std::endl << std::setw(10) << "allocs";
+	for (int i = 0; i < 4; ++i)
+		printCell(res[i], res[i].allocs);
+	std::cout << std::endl << std::setw(10) << "leaked";
+	for (int i = 0; i < 4; ++i)
+		printCell(res[i], res[i].leaked);
+	std::cout << std::endl;
+}
+
+template <typename Vector>
+Result benchPushBack(long n) {
+	g_allocs = 0;
+	g_live = 0;
+	clock_t start = clock();
+	{
+		Vector vec;
+		for (long i = 0; i < n; ++i)
+			vec.push_back(static_cast<int>(i));
+		g_sink += vec.size();
+	}
+	Result res = { ns_per_op(start, clock(), n), g_allocs, g_live };
+	return res;
+}
+
+// insert(end(), val), insert(end(), n, val) and resize: the paths that reallocated exactly before.
+template <typename Vector>
+Result benchInsertEnd(long n) {
+	g_allocs = 0;
+	g_live = 0;
+	clock_t start = clock();
+	{
+		Vector vec;
+		for (long i = 0; i < n; i += 4) {
+			vec.insert(vec.end(), static_cast<int>(i));
+			vec.insert(vec.end(), 2, static_cast<int>(i));
+			vec.resize(vec.size() + 1);
+		}
+		g_sink += vec.size();
+	}
+	Result res = { ns_per_op(start, clock(), n), g_allocs, g_live };
+	return res;
+}
+
+// Inserts in the middle, dominated by the shift of the back half.
+template <typename Vector>
+Result benchInsertMiddle(long n) {
+	g_allocs = 0;
+	g_live = 0;
+	clock_t start = clock();
+	{
+		Vector vec;
+		for (long i = 0; i < n; ++i)
+			vec.insert(vec.begin() + vec.size() / 2, static_cast<int>(i));
+		g_sink += vec.size();
+	}
+	Result res = { ns_per_op(start, clock(), n), g_allocs, g_live };
+	return res;
+}
+
+// Small struct, moved with memcpy because it is trivially copyable.
+struct Particle {
+	double	x, y, z;
+	int			id;
+};
+
+// Owns a heap block and copies it deeply, relocatable only when Relocatable is true.
+template <bool Relocatable>
+struct Handle {
+	int*	data;
+
+	Handle() : data(new int[4]()) {}
+	Handle(const Handle& h) : data(new int[4]) { std::copy(h.data, h.data + 4, data); }
+	~Handle() { delete[] data; }
+	Handle& operator=(const Handle& h) { std::copy(h.data, h.data + 4, data); return *this; }
+};
+
+namespace ft {
+	template <>
+	struct is_relocatable<Handle<true> > { enum _value { value = true }; };
+}
+
+// Grows to n elements without reserve and returns the time per push_back.
+template <typename Vector>
+double benchGrow(long n) {
+	typename Vector::value_type val = typename Vector::value_type();
+	clock_t start = clock();
+	{
+		Vector vec;
+		for (long i = 0; i < n; ++i)
+			vec.push_back(val);
+		g_sink += vec.size();
+	}
+	return ns_per_op(start, clock(), n);
+}
+
+// Front insert and erase on n elements, the time per operation is the shift of the whole vector.
+template <typename Vector>
+double benchShift(long n) {
+	Vector vec(n, typename Vector::value_type());
+	long ops = 10000000 / n + 1;
+	clock_t start = clock();
+	for (long i = 0; i < ops; ++i) {
+		vec.insert(vec.begin(), vec.back());
+		vec.erase(vec.begin());
+	}
+	g_sink += vec.size();
+	return ns_per_op(start, clock(), ops * 2);
+}
+
+// Erases the front of a vector of n copies of val, ns per erase.
+template <typename Vector>
+double benchFrontErase(long n, const typename Vector::value_type& val) {
+	Vector vec(n, val);
+	long ops = std::min(n / 2, 10000000 / n + 1);
+	clock_t start = clock();
+	for (long i = 0; i < ops; ++i)
+		vec.erase(vec.begin());
+	g_sink += vec.size();
+	return ns_per_op(start, clock(), ops);
+}
+
+// Inserts val in the middle of a vector of n copies of val with room for all inserts, ns per insert.
+template <typename Vector>
+double benchMiddleInsert(long n, const typename Vector::value_type& val) {
+	Vector vec(n, val);
+	long ops = std::min(n / 2, 10000000 / n + 1);
+	vec.reserve(n + ops);
+	clock_t start = clock();
+	for (long i = 0; i < ops; ++i)
+		vec.insert(vec.begin() + vec.size() / 2, val);
+	g_sink += vec.size();
+	return ns_per_op(start, clock(), ops);
+}
+
+// Overwrites a snapshot vector with copies of two sources of n and 3n / 4 elements, alternately, like a per-tick copy.
+// Returns ns per copied element, allocs gets the allocations per assignment.
+template <typename Vector>
+double benchAssign(long n, const typename Vector::value_type& val, double& allocs) {
+	Vector big(n, val);
+	Vector small(n * 3 / 4, val);
+	Vector snapshot(big);
+	long ticks = 20000000 / n + 2;
+	g_allocs = 0;
+	clock_t start = clock();
+	for (long i = 0; i < ticks; ++i)
+		snapshot = (i % 2) ? big : small;
+	double res = ns_per_op(start, clock(), ticks * (n * 7 / 8));
+	allocs = static_cast<double>(g_allocs) / ticks;
+	g_sink += snapshot.size();
+	return res;
+}
+
+// Builds and drops count vectors of k elements, like per-request scratch vectors.
+// Returns the time per vector, allocs gets the allocations per vector.
+template <typename Vector>
+double benchShortLived(long count, int k, double& allocs) {
+	g_allocs = 0;
+	clock_t start = clock();
+	for (long i = 0; i < count; ++i) {
+		Vector vec;
+		for (int j = 0; j < k; ++j)
+			vec.push_back(static_cast<int>(i + j));
+		g_sink += vec.back();
+	}
+	allocs = static_cast<double>(g_allocs) / count;
+	return ns_per_op(start, clock(), count);
+}
+
+// Heavy record, a copy duplicates its string on the heap.
+struct Record {
+	long				id;
+	double			score;
+	std::string	name;
+
+	Record(long i, const char* n) : id(i), score(i * 0.5), name(n) {}
+};
+
+static const char* g_record_name = "a record name longer than the small string buffer";
+
+// Appends n records to a reserved vector, each one a copy of a temporary.
+template <typename Vector>
+double benchPushRecord(long n) {
+	Vector vec;
+	vec.reserve(n);
+	clock_t start = clock();
+	for (long i = 0; i < n; ++i)
+		vec.push_back(Record(i, g_record_name));
+	double res = ns_per_op(start, clock(), n);
+	g_sink += vec.back().id;
+	return res;
+}
+
+// Same appends, each record built in place.
+double benchEmplaceRecord(long n) {
+	ft::vector<Record> vec;
+	vec.reserve(n);
+	clock_t start = clock();
+	for (long i = 0; i < n; ++i)
+		vec.emplace_back(i, g_record_name);
+	double res = ns_per_op(start, clock(), n);
+	g_sink += vec.back().id;
+	return res;
+}
+
+// Fills an outer vector with n inner vectors of 64 ints, then times one growth of the outer one.
+// allocs gets the inner allocations made by that growth.
+template <typename Outer>
+double benchNested(long n, double& allocs) {
+	Outer outer(n, typename Outer::value_type(64, 1));
+	g_allocs = 0;
+	clock_t start = clock();
+	outer.reserve(outer.capacity() * 2);
+	double res = ns_per_op(start, clock(), n);
+	allocs = static_cast<double>(g_allocs) / n;
+	g_sink += outer.size();
+	return res;
+}
+
+#ifdef __linux__
+// Appends n ints with push_back in a child process, so the peak RSS is the one of this run only.
+// Returns false when the child fails, e.g. killed for lack of memory.
+template <typename Vector>
+bool benchHuge(long n, double& time, double& peak_mb) {
+	int fds[2];
+	if (pipe(fds) != 0)
+		return false;
+	pid_t pid = fork();
+	if (pid == 0) {
+		close(fds[0]);
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		long base = usage.ru_maxrss;
+		double res[2];
+		clock_t start = clock();
+		{
+			Vector vec;
+			for (long i = 0; i < n; ++i)
+				vec.push_back(static_cast<int>(i));
+			res[0] = ns_per_op(start, clock(), n);
+			getrusage(RUSAGE_SELF, &usage);
+			res[1] = (usage.ru_maxrss - base) / 1024.0;
+			g_sink += vec.size();
+		}
+		ssize_t written = write(fds[1], res, sizeof(res));
+		_exit(written == sizeof(res) ? 0 : 1);
+	}
+	close(fds[1]);
+	double res[2];
+	bool ok = pid > 0 && read(fds[0], res, sizeof(res)) == sizeof(res);
+	close(fds[0]);
+	int status = 0;
+	if (pid > 0)
+		waitpid(pid, &status, 0);
+	time = res[0];
+	peak_mb = res[1];
+	return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+#endif
+
+// resize_uninitialized is an ft extension, std::vector has no equivalent.
+template <typename T>
+void resizeUninitialized(ft::vector<T>& vec, long n) { vec.resize_uninitialized(n); }
+template <typename T>
+void resizeUninitialized(std::vector<T>& vec, long n) { vec.resize(n); }
+
+// Compares two vectors of n elements that differ only in the last one, reps times.
+// Returns the throughput in GB/s of one operand. Generic is the element loop the operators used before.
+template <typename Vector>
+double benchCompare(long n, bool less, bool generic) {
+	typedef typename Vector::value_type T;
+	Vector lhs(n, T(1));
+	Vector rhs(lhs);
+	rhs[n - 1] = T(2);
+	long reps = 500000000 / (n * sizeof(T)) + 1;
+	clock_t start = clock();
+	for (long i = 0; i < reps; ++i) {
+		if (generic)
+			g_sink += less ? ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())
+						   : ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+		else
+			g_sink += less ? lhs < rhs : lhs == rhs;
+	}
+	double sec = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+	return sec > 0 ? static_cast<double>(n) * sizeof(T) * reps / sec / 1e9 : 0;
+}
+
+// Milliseconds of one fill of n ints with val: 0 the fill constructor, 1 assign, 2 resize from empty,
+// 3 resize_uninitialized from empty. 1 to 3 run on reserved memory that was already written once.
+double msFill(clock_t start) { return static_cast<double>(clock() - start) * 1000 / CLOCKS_PER_SEC; }
+
+template <typename Vector>
+double benchFill(long n, int val, int op) {
+	clock_t start = clock();
+	if (op == 0) {
+		Vector vec(n, val);
+		double res = msFill(start);
+		g_sink += vec[n - 1];
+		return res;
+	}
+	Vector vec(n, 1);
+	vec.clear();
+	start = clock();
+	if (op == 1)
+		vec.assign(n, val);
+	else if (op == 2)
+		vec.resize(n, val);
+	else
+		resizeUninitialized(vec, n);
+	double res = msFill(start);
+	g_sink += vec.size();
+	return res;
+}
+
+void runPushBack(long max_n) {
+	printHeader("push_back (ns/op)");
+	for (long n = 1000; n <= max_n; n *= 10) {
+		Result exact = { -1, 0, 0 };	// skipped
+		if (n <= EXACT_MAX_N)
+			exact = benchPushBack<FtExact>(n);
+		Result res[4] = { benchPushBack<FtDouble>(n), benchPushBack<FtHalf>(n), exact, benchPushBack<Std>(n) };
+		printRows(n, res);
+	}
+}
+
+void runInsertEnd(long max_n) {
+	printHeader("insert(end()) + insert(end(), 2) + resize (ns/element)");
+	for (long n = 1000; n <= max_n; n *= 10) {
+		Result exact = { -1, 0, 0 };	// skipped
+		if (n <= EXACT_MAX_N)
+			exact = benchInsertEnd<FtExact>(n);
+		Result res[4] = { benchInsertEnd<FtDouble>(n), benchInsertEnd<FtHalf>(n), exact, benchInsertEnd<Std>(n) };
+		printRows(n, res);
+	}
+}
+
+void runInsertMiddle(long max_n) {
+	printHeader("insert(begin() + size() / 2) (ns/op)");
+	for (long n = 1000; n <= max_n && n <= 100000; n *= 10) {
+		Result exact = { -1, 0, 0 };	// skipped
+		if (n <= EXACT_MAX_N)
+			exact = benchInsertMiddle<FtExact>(n);
+		Result res[4] = { benchInsertMiddle<FtDouble>(n), benchInsertMiddle<FtHalf>(n), exact, benchInsertMiddle<Std>(n) };
+		printRows(n, res);
+	}
+}
+
+void runRelocate(long max_n) {
+	std::cout << "\n===== relocation: push_back / front insert + erase (ns/op) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "ft struct" << std::setw(14) << "std struct"
+						<< std::setw(14) << "ft handle" << std::setw(14) << "ft handle*" << std::setw(14) << "std handle" << std::endl;
+	std::cout << "(handle: owns a heap block, ft handle is relocatable, ft handle* is copied)" << std::endl;
+	for (long n = 1000; n <= max_n; n *= 10) {
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n
+							<< std::setw(14) << benchGrow<ft::vector<Particle> >(n)
+							<< std::setw(14) << benchGrow<std::vector<Particle> >(n)
+							<< std::setw(14) << benchGrow<ft::vector<Handle<true> > >(n)
+							<< std::setw(14) << benchGrow<ft::vector<Handle<false> > >(n)
+							<< std::setw(14) << benchGrow<std::vector<Handle<false> > >(n) << std::endl;
+		std::cout << std::setw(10) << "shift"
+							<< std::setw(14) << benchShift<ft::vector<Particle> >(n)
+							<< std::setw(14) << benchShift<std::vector<Particle> >(n)
+							<< std::setw(14) << benchShift<ft::vector<Handle<true> > >(n) << std::endl;
+	}
+}
+
+void runShift(long max_n) {
+	const Handle<false> handle;
+	const std::string str(g_record_name);
+	std::cout << "\n===== shift of elements that are not relocatable (ns/op) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "ft handle*" << std::setw(14) << "std handle*"
+						<< std::setw(14) << "ft string" << std::setw(14) << "std string" << std::endl;
+	for (long n = 1000; n <= max_n && n <= 100000; n *= 10) {
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n
+							<< std::setw(14) << benchFrontErase<ft::vector<Handle<false> > >(n, handle)
+							<< std::setw(14) << benchFrontErase<std::vector<Handle<false> > >(n, handle)
+							<< std::setw(14) << benchFrontErase<ft::vector<std::string> >(n, str)
+							<< std::setw(14) << benchFrontErase<std::vector<std::string> >(n, str) << "  front erase" << std::endl;
+		std::cout << std::setw(10) << ""
+							<< std::setw(14) << benchMiddleInsert<ft::vector<Handle<false> > >(n, handle)
+							<< std::setw(14) << benchMiddleInsert<std::vector<Handle<false> > >(n, handle)
+							<< std::setw(14) << benchMiddleInsert<ft::vector<std::string> >(n, str)
+							<< std::setw(14) << benchMiddleInsert<std::vector<std::string> >(n, str) << "  middle insert" << std::endl;
+	}
+}
+
+void runAssign(long max_n) {
+	typedef std::basic_string<char, std::char_traits<char>, CountingAllocator<char> > String;	// counts its buffers too
+	typedef ft::vector<String, CountingAllocator<String> >	FtString;
+	typedef std::vector<String, CountingAllocator<String> >	StdString;
+	const String str(g_record_name);
+	std::cout << "\n===== snapshot copy assignment: ns per element / allocations per assignment =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "ft int" << std::setw(14) << "std int"
+						<< std::setw(14) << "ft string" << std::setw(14) << "std string" << std::endl;
+	for (long n = 1000; n <= max_n; n *= 10) {
+		double allocs[4];
+		double time[4] = { benchAssign<FtDouble>(n, 42, allocs[0]), benchAssign<Std>(n, 42, allocs[1]),
+							benchAssign<FtString>(n, str, allocs[2]), benchAssign<StdString>(n, str, allocs[3]) };
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n;
+		for (int i = 0; i < 4; ++i)
+			std::cout << std::setw(14) << time[i];
+		std::cout << std::endl << std::setw(10) << "allocs";
+		for (int i = 0; i < 4; ++i)
+			std::cout << std::setw(14) << allocs[i];
+		std::cout << std::endl;
+	}
+}
+
+void runShortLived(long max_n) {
+	typedef ft::small_vector<int, 8, CountingAllocator<int> >	Small;
+	std::cout << "\n===== short-lived vectors of k ints: ns per vector / allocations per vector =====" << std::endl;
+	std::cout << std::setw(10) << "k" << std::setw(14) << "ft vector" << std::setw(14) << "small_vec<8>"
+						<< std::setw(14) << "std" << std::endl;
+	const int sizes[5] = { 1, 4, 8, 9, 32 };
+	for (int i = 0; i < 5; ++i) {
+		double allocs[3];
+		double time[3] = { benchShortLived<FtDouble>(max_n, sizes[i], allocs[0]),
+							benchShortLived<Small>(max_n, sizes[i], allocs[1]),
+							benchShortLived<Std>(max_n, sizes[i], allocs[2]) };
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << sizes[i];
+		for (int j = 0; j < 3; ++j)
+			std::cout << std::setw(14) << time[j];
+		std::cout << std::endl << std::setw(10) << "allocs";
+		for (int j = 0; j < 3; ++j)
+			std::cout << std::setw(14) << allocs[j];
+		std::cout << std::endl;
+	}
+}
+
+void runEmplace(long max_n) {
+	std::cout << "\n===== append a record with a heap string (ns/op) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "ft push_back" << std::setw(14) << "ft emplace"
+						<< std::setw(14) << "std push_back" << std::endl;
+	for (long n = 1000; n <= max_n; n *= 10) {
+		benchPushRecord<std::vector<Record> >(n);	// warm-up, the first run pays the page faults of the strings
+		long reps = 5000000 / n + 1;
+		double time[3] = { 0, 0, 0 };
+		for (long i = 0; i < reps; ++i) {
+			time[0] += benchPushRecord<ft::vector<Record> >(n) / reps;
+			time[1] += benchEmplaceRecord(n) / reps;
+			time[2] += benchPushRecord<std::vector<Record> >(n) / reps;
+		}
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n;
+		for (int i = 0; i < 3; ++i)
+			std::cout << std::setw(14) << time[i];
+		std::cout << std::endl;
+	}
+}
+
+void runNested(long max_n) {
+	typedef ft::vector<int, CountingAllocator<int> >	FtInner;
+	typedef std::vector<int, CountingAllocator<int> >	StdInner;
+	std::cout << "\n===== nested vectors: reserve of n vectors of 64 ints (ns / inner allocations per inner vector) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "ft<ft>" << std::setw(14) << "ft<std>"
+						<< std::setw(14) << "std<std>" << std::endl;
+	std::cout << "(ft<ft> swaps the inner vectors on growth, ft<std> and C++98 std<std> copy them)" << std::endl;
+	for (long n = 1000; n <= max_n; n *= 10) {
+		double allocs[3];
+		double time[3] = { benchNested<ft::vector<FtInner> >(n, allocs[0]),
+							benchNested<ft::vector<StdInner> >(n, allocs[1]),
+							benchNested<std::vector<StdInner> >(n, allocs[2]) };
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n;
+		for (int i = 0; i < 3; ++i)
+			std::cout << std::setw(14) << time[i];
+		std::cout << std::endl << std::setw(10) << "allocs";
+		for (int i = 0; i < 3; ++i)
+			std::cout << std::setw(14) << allocs[i];
+		std::cout << std::endl;
+	}
+}
+
+void runCompare(long max_n) {
+	std::cout << "\n===== operator== / operator< throughput (GB/s) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(8) << "" << std::setw(14) << "ft generic"
+						<< std::setw(14) << "ft" << std::setw(14) << "std" << std::endl;
+	for (long n = 1000; n <= max_n * 10; n *= 100) {
+		for (int less = 0; less < 2; ++less) {
+			std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n << std::setw(8) << (less ? "u8 <" : "u8 ==")
+								<< std::setw(14) << benchCompare<ft::vector<unsigned char> >(n, less, true)
+								<< std::setw(14) << benchCompare<ft::vector<unsigned char> >(n, less, false)
+								<< std::setw(14) << benchCompare<std::vector<unsigned char> >(n, less, false) << std::endl;
+			std::cout << std::setw(10) << "" << std::setw(8) << (less ? "int <" : "int ==")
+								<< std::setw(14) << benchCompare<ft::vector<int> >(n, less, true)
+								<< std::setw(14) << benchCompare<ft::vector<int> >(n, less, false)
+								<< std::setw(14) << benchCompare<std::vector<int> >(n, less, false) << std::endl;
+		}
+	}
+}
+
+void runFill(long max_n) {
+	const char* ops[4] = { "vector(n, v)", "assign", "resize", "resize_uninit" };
+	std::cout << "\n===== bulk fill of n ints (ms) =====" << std::endl;
+	std::cout << std::setw(14) << "" << std::setw(14) << "ft zero" << std::setw(14) << "std zero"
+						<< std::setw(14) << "ft pattern" << std::setw(14) << "std pattern" << std::endl;
+	for (long n = max_n * 4; n <= max_n * 256; n *= 64) {
+		std::cout << "n = " << n << " (" << n * sizeof(int) / (1 << 20) << " MB)" << std::endl;
+		for (int op = 0; op < 4; ++op) {
+			std::cout << std::fixed << std::setprecision(1) << std::setw(14) << ops[op];
+			for (int i = 0; i < 2; ++i) {
+				int val = i ? 0x01020304 : 0;
+				Result skip = { op == 3 ? -1.0 : 0.0, 0, 0 };
+				std::cout << std::setw(14) << benchFill<ft::vector<int> >(n, val, op);
+				printCell(skip, skip.time < 0 ? 0 : benchFill<std::vector<int> >(n, val, op));
+			}
+			std::cout << std::endl;
+		}
+	}
+}
+
+// Vectors of up to about 256 * max_n ints, one past a power of two so the last element triggers a growth:
+// the doubling path then holds the old and the new buffer while it copies,
+// mmap_allocator grows the mapping with mremap and never holds both.
+void runHuge(long max_n) {
+#ifdef __linux__
+	typedef ft::mmap_allocator<int>				Mapped;
+	typedef ft::mmap_allocator<int, true>	Huge;
+	std::cout << "\n===== push_back of huge vectors: ns/op / peak RSS (MB) =====" << std::endl;
+	std::cout << std::setw(10) << "n" << std::setw(14) << "ft alloc" << std::setw(14) << "ft mmap"
+						<< std::setw(14) << "ft mmap+thp" << std::setw(14) << "std" << std::endl;
+	long pow2 = 1;
+	while (pow2 < max_n * 16)
+		pow2 *= 2;
+	for (; pow2 < max_n * 512; pow2 *= 4) {
+		long n = pow2 + 1;
+		double time[4];
+		double peak[4];
+		bool ok[4] = { benchHuge<ft::vector<int> >(n, time[0], peak[0]),
+						benchHuge<ft::vector<int, Mapped> >(n, time[1], peak[1]),
+						benchHuge<ft::vector<int, Huge> >(n, time[2], peak[2]),
+						benchHuge<std::vector<int> >(n, time[3], peak[3]) };
+		std::cout << std::fixed << std::setprecision(1) << std::setw(10) << n;
+		for (int i = 0; i < 4; ++i) {
+			Result cell = { ok[i] ? time[i] : -1, 0, 0 };
+			printCell(cell, time[i]);
+		}
+		std::cout << std::setprecision(0) << std::endl << std::setw(10) << "peak MB";
+		for (int i = 0; i < 4; ++i) {
+			Result cell = { ok[i] ? time[i] : -1, 0, 0 };
+			printCell(cell, peak[i]);
+		}
+		std::cout << std::endl;
+	}
+#else
+	(void)max_n;
+#endif
+}
+
+int main(int argc, char** argv) {
+	long max_n = 1000000;
+	if (argc > 1)
+		max_n = atol(argv[1]);
+	std::cout << "################ Bench Vector ################" << std::endl;
+	runPushBack(max_n);
+	runInsertEnd(max_n);
+	runInsertMiddle(max_n);
+	runRelocate(max_n);
+	runShift(max_n);
+	runAssign(max_n);
+	runShortLived(max_n);
+	runEmplace(max_n);
+	runNested(max_n);
+	runCompare(max_n);
+	runFill(max_n);
+	runHuge(max_n);
+	return 0;
+}
@@ -1,5 +1,9 @@
 #include "vector.hpp"
+#include "mmap_allocator.hpp"
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -7,6 +11,8 @@
 #define TESTED_NAMESPACE ft
 #endif
 
+#include "tested.hpp"
+
 #define TYPE int
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::vector<T>::size_type
 
@@ -28,6 +34,155 @@ void printContainers(TESTED_NAMESPACE::vector<T> const &vec, bool print_content
 	std::cout << "------------------------" << std::endl;
 }
 
+// Element built from several constructor arguments.
+struct Record {
+	int					id;
+	std::string	name;
+
+	Record(int i, const std::string& n) : id(i), name(n) {}
+	Record(int i, const std::string& n, int copies) : id(i), name() {
+		while (copies-- > 0)
+			name += n;
+	}
+};
+
+std::ostream& operator<<(std::ostream& os, const Record& rec) { return os << rec.id << ":" << rec.name; }
+
+// Owns a heap buffer and nothing points back into it, so it can be moved with memcpy.
+// live counts the objects constructed and not destroyed yet.
+class Buffer {
+public:
+	static int	live;
+
+	Buffer(int v = 0) : _data(new int(v)) { ++live; }
+	Buffer(const Buffer& x) : _data(new int(*x._data)) { ++live; }
+	~Buffer() { delete _data; --live; }
+	Buffer& operator=(const Buffer& x) { *_data = *x._data; return *this; }
+	int value() const { return *_data; }
+
+private:
+	int*	_data;
+};
+
+int Buffer::live = 0;
+
+std::ostream& operator<<(std::ostream& os, const Buffer& buf) { return os << buf.value(); }
+
+namespace ft {
+	template <>
+	struct is_relocatable<Buffer> { enum _value { value = true }; };
+}
+
+// std::vector has no emplace in C++98, its reference output comes from push_back and insert.
+template <typename T, typename A1>
+void emplaceBack(ft::vector<T>& vec, const A1& a1) { vec.emplace_back(a1); }
+template <typename T, typename A1>
+void emplaceBack(std::vector<T>& vec, const A1& a1) { vec.push_back(T(a1)); }
+template <typename T, typename A1, typename A2>
+void emplaceBack(ft::vector<T>& vec, const A1& a1, const A2& a2) { vec.emplace_back(a1, a2); }
+template <typename T, typename A1, typename A2>
+void emplaceBack(std::vector<T>& vec, const A1& a1, const A2& a2) { vec.push_back(T(a1, a2)); }
+
+template <typename T, typename A1>
+typename ft::vector<T>::iterator emplaceAt(ft::vector<T>& vec, typename ft::vector<T>::iterator pos, const A1& a1) {
+	return vec.emplace(pos, a1);
+}
+template <typename T, typename A1>
+typename std::vector<T>::iterator emplaceAt(std::vector<T>& vec, typename std::vector<T>::iterator pos, const A1& a1) {
+	return vec.insert(pos, T(a1));
+}
+template <typename T, typename A1, typename A2, typename A3>
+typename ft::vector<T>::iterator emplaceAt(ft::vector<T>& vec, typename ft::vector<T>::iterator pos,
+																					const A1& a1, const A2& a2, const A3& a3) {
+	return vec.emplace(pos, a1, a2, a3);
+}
+template <typename T, typename A1, typename A2, typename A3>
+typename std::vector<T>::iterator emplaceAt(std::vector<T>& vec, typename std::vector<T>::iterator pos,
+																						const A1& a1, const A2& a2, const A3& a3) {
+	return vec.insert(pos, T(a1, a2, a3));
+}
+
+// resize_uninitialized is an ft extension, std::vector value-initializes with resize.
+template <typename T>
+void resizeUninitialized(ft::vector<T>& vec, size_t n) { vec.resize_uninitialized(n); }
+template <typename T>
+void resizeUninitialized(std::vector<T>& vec, size_t n) { vec.resize(n); }
+
+// Prints the size and the elements that differ from val, for vectors too long to print.
+template <typename T>
+void printFilled(const std::string& title, const TESTED_NAMESPACE::vector<T>& vec, const T& val) {
+	size_t diff = 0;
+	for (size_t i = 0; i < vec.size(); ++i)
+		diff += !(vec[i] == val);
+	std::cout << title << ": size " << vec.size() << " not " << val << ": " << diff << std::endl;
+}
+
+// Two vectors of n copies of fill, rhs gets diff at position pos (if pos < n) and extra more elements.
+template <typename T>
+void printCompare(const std::string& title, size_t n, T fill, size_t pos, T diff, size_t extra) {
+	TESTED_NAMESPACE::vector<T> lhs(n, fill);
+	TESTED_NAMESPACE::vector<T> rhs(n + extra, fill);
+	if (pos < n)
+		rhs[pos] = diff;
+	std::cout << title << ": == " << (lhs == rhs) << " != " << (lhs != rhs) << " < " << (lhs < rhs)
+			  << " <= " << (lhs <= rhs) << " > " << (lhs > rhs) << " >= " << (lhs >= rhs) << std::endl;
+}
+
+// std has no mmap allocator, the std reference output comes from std::allocator.
+// Buffers of 4KB and more are mapped, so the vector grows with mremap past 1024 ints.
+#define MMAP_ALLOCATOR_ft(T)	ft::mmap_allocator<T, false, 4096>
+#define MMAP_ALLOCATOR_std(T)	std::allocator<T>
+#define MMAP_ALLOCATOR(T)			TESTED(MMAP_ALLOCATOR)(T)
+
+// std::vector has no growth policy, its reference output comes from reserve() with the expected capacities.
+#define GROWTH_VECTOR_ft(G)		ft::vector<int, std::allocator<int>, ft::G>
+#define GROWTH_VECTOR_std(G)	std::vector<int>
+#define GROWTH_VECTOR(G)			TESTED(GROWTH_VECTOR)(G)
+
+// Every capacity printGrowth must go through, in order.
+static const size_t double_capacities[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256, 512 };
+static const size_t half_capacities[] = { 1, 2, 3, 4, 6, 9, 13, 19, 28, 42, 63, 94, 141, 211, 316, 474, 711 };
+static const size_t exact_capacities[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 40, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100 };
+
+template <typename T, typename Growth>
+void reserveGrowth(ft::vector<T, std::allocator<T>, Growth>&, size_t, const size_t*&) {}
+template <typename T>
+void reserveGrowth(std::vector<T>& vec, size_t n, const size_t*& expected) {
+	if (vec.size() + n > vec.capacity())
+		vec.reserve(*expected++);
+}
+
+// Prints every capacity the vector goes through while it grows by push_back, fill, range and single inserts.
+template <typename V>
+void printGrowth(const std::string& title, const size_t* expected, int push_backs, int inserts) {
+	V vec;
+	int values[50];
+	for (int i = 0; i < 50; ++i)
+		values[i] = i;
+	std::cout << title << " push_back:";
+	size_t last = vec.capacity();
+	for (int i = 0; i < push_backs; ++i) {
+		reserveGrowth(vec, 1, expected);
+		vec.push_back(i);
+		if (vec.capacity() != last)
+			std::cout << " " << (last = vec.capacity());
+	}
+	reserveGrowth(vec, 30, expected);
+	vec.insert(vec.end(), 30, 7);
+	std::cout << std::endl << title << " fill insert: " << vec.capacity();
+	reserveGrowth(vec, 50, expected);
+	vec.insert(vec.begin(), values, values + 50);
+	std::cout << " range insert: " << vec.capacity() << std::endl << title << " insert:";
+	last = vec.capacity();
+	for (int i = 0; i < inserts; ++i) {
+		reserveGrowth(vec, 1, expected);
+		vec.insert(vec.begin() + vec.size() / 2, i);
+		if (vec.capacity() != last)
+			std::cout << " " << (last = vec.capacity());
+	}
+	std::cout << std::endl << title << " size: " << vec.size() << " middle: " << vec[vec.size() / 2] << std::endl;
+}
+
 int main() {
 	std::cout << "################ Test Vector ################" << std::endl;
 
@@ -48,6 +203,26 @@ int main() {
 	printContainers(v_assign);
 	v_assign = v_copy;
 	printContainers(v_assign);
+	v_assign.reserve(20);
+	v_assign = v_fill;
+	std::cout << "capacity kept: " << v_assign.capacity() << std::endl;
+	printContainers(v_assign);
+	v_assign = v_range;
+	std::cout << "capacity kept: " << v_assign.capacity() << std::endl;
+	printContainers(v_assign);
+
+	TESTED_NAMESPACE::vector<std::string> v_assign_str(3, "a string too long for the small string buffer");
+	TESTED_NAMESPACE::vector<std::string> v_assign_str2(6, "short");
+	v_assign_str2[5] = "last";
+	v_assign_str.reserve(10);
+	v_assign_str = v_assign_str2;
+	std::cout << "capacity kept: " << v_assign_str.capacity() << std::endl;
+	printContainers(v_assign_str);
+	v_assign_str2.resize(2);
+	v_assign_str = v_assign_str2;
+	printContainers(v_assign_str);
+	v_assign_str = TESTED_NAMESPACE::vector<std::string>();
+	printContainers(v_assign_str);
 
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== begin | end | rbegin | rend =====" << std::endl;
@@ -74,6 +249,26 @@ int main() {
 	std::cout << "capacity after resize: " << v_size.capacity() << std::endl;
 	printContainers(v_size, false);
 
+	std::cout << "bulk fill ..." << std::endl;
+	TESTED_NAMESPACE::vector<int> v_bulk(5000, 0x01020304);
+	printFilled("fill", v_bulk, 0x01020304);
+	v_bulk.assign(3001, -1);
+	printFilled("assign", v_bulk, -1);
+	v_bulk.resize(9000);
+	v_bulk.erase(v_bulk.begin(), v_bulk.begin() + 3001);
+	printFilled("resize", v_bulk, 0);
+	v_bulk.insert(v_bulk.begin() + 10, 1025, 7);
+	printFilled("insert", v_bulk, 0);
+	TESTED_NAMESPACE::vector<double> v_fill_double(1500, 0.5);
+	printFilled("double", v_fill_double, 0.5);
+	TESTED_NAMESPACE::vector<char> v_read(3, 'a');
+	resizeUninitialized(v_read, 4100);
+	for (size_t i = 3; i < v_read.size(); ++i)
+		v_read[i] = 'b';
+	printFilled("resize_uninitialized", v_read, 'b');
+	resizeUninitialized(v_read, 2);
+	printContainers(v_read);
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== reserve test =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_reserve;
@@ -134,6 +329,17 @@ int main() {
 	printContainers(vecA);
 	printContainers(vecB);
 
+	std::cout << "single-pass input iterators: " << std::endl;
+	std::istringstream in_range("1 2 3 4 5 6 7 8 9");
+	TESTED_NAMESPACE::vector<TYPE> vecE((std::istream_iterator<TYPE>(in_range)), std::istream_iterator<TYPE>());
+	printContainers(vecE);
+	std::istringstream in_assign("10 20 30");
+	vecE.assign(std::istream_iterator<TYPE>(in_assign), std::istream_iterator<TYPE>());
+	printContainers(vecE);
+	std::istringstream in_insert("-1 -2");
+	vecE.insert(vecE.begin() + 1, std::istream_iterator<TYPE>(in_insert), std::istream_iterator<TYPE>());
+	printContainers(vecE);
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== push_back | pop_back =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_pushpop;
@@ -185,6 +391,54 @@ int main() {
 	v_insert.erase(--(--v_insert.end()), v_insert.end());
 	printContainers(v_insert);
 
+	std::cout << "+++ insert from a list +++" << std::endl;
+	std::list<TYPE> l_insert;
+	for (unsigned int i = 0; i < v_insert2.size(); ++i)
+		l_insert.push_back(v_insert2[i]);
+	v_insert.insert(v_insert.end(), l_insert.rbegin(), l_insert.rend());
+	printContainers(v_insert);
+
+	std::cout << "+++ insert from reverse iterators +++" << std::endl;
+	v_insert.insert(v_insert.begin() + 1, v_insert2.rbegin(), v_insert2.rend());
+	printContainers(v_insert);
+
+	std::cout << "+++ erase +++" << std::endl;
+	v_insert.erase(v_insert.begin() + 2, v_insert.end() - 3);
+	printContainers(v_insert);
+
+	std::cout << "+++ insert | erase of strings in reserved memory +++" << std::endl;
+	const std::string words[6] = { "alpha", "a string too long for the small string buffer", "gamma",
+									"delta", "another string that lives on the heap", "zeta" };
+	TESTED_NAMESPACE::vector<std::string> v_words(words, words + 6);
+	v_words.reserve(40);
+	v_words.insert(v_words.begin() + 1, 2, v_words[4]);
+	v_words.insert(v_words.begin() + 6, 4, words[0]);
+	v_words.insert(v_words.begin() + 2, words + 3, words + 5);
+	v_words.insert(v_words.end() - 1, words, words + 6);
+	printContainers(v_words);
+	v_words.erase(v_words.begin());
+	v_words.erase(v_words.begin() + 3, v_words.begin() + 9);
+	v_words.erase(v_words.end() - 2, v_words.end());
+	printContainers(v_words);
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== emplace_back | emplace =====" << std::endl;
+	TESTED_NAMESPACE::vector<Record> v_emplace;
+	for (int i = 0; i < 5; ++i)
+		emplaceBack(v_emplace, i, "record");
+	printContainers(v_emplace);
+	std::cout << "*emplace: " << *emplaceAt(v_emplace, v_emplace.begin() + 2, 42, "ab", 3) << std::endl;
+	std::cout << "*emplace: " << *emplaceAt(v_emplace, v_emplace.end(), v_emplace[0].id, v_emplace[1].name, 2) << std::endl;
+	printContainers(v_emplace);
+
+	TESTED_NAMESPACE::vector<TYPE> v_emplace_int;
+	for (int i = 0; i < 6; ++i)
+		emplaceBack(v_emplace_int, i * 7);
+	emplaceBack(v_emplace_int, v_emplace_int[2]);
+	std::cout << "*emplace: " << *emplaceAt(v_emplace_int, v_emplace_int.begin() + 1, v_emplace_int[4]) << std::endl;
+	std::cout << "*emplace: " << *emplaceAt(v_emplace_int, v_emplace_int.begin(), v_emplace_int.back()) << std::endl;
+	printContainers(v_emplace_int);
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== swap =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_swapA(5);
@@ -221,6 +475,68 @@ int main() {
 	std::cout << "after clear: " << std::endl;
 	printContainers(v_clear);
 
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== relocatable elements =====" << std::endl;
+	{
+		TESTED_NAMESPACE::vector<Buffer> v_buf;
+		for (int i = 0; i < 20; ++i)
+			v_buf.push_back(Buffer(i));
+		Buffer buf_values[4] = { Buffer(100), Buffer(101), Buffer(102), Buffer(103) };
+		v_buf.insert(v_buf.begin() + 3, Buffer(-1));
+		v_buf.insert(v_buf.begin() + 5, 3, Buffer(-2));
+		v_buf.insert(v_buf.begin(), buf_values, buf_values + 4);
+		v_buf.reserve(v_buf.capacity() + 1);
+		v_buf.insert(v_buf.end() - 2, Buffer(-3));
+		v_buf.erase(v_buf.begin() + 1);
+		v_buf.erase(v_buf.begin() + 6, v_buf.begin() + 10);
+		v_buf.insert(v_buf.begin() + 2, v_buf.back());
+		v_buf.resize(30, Buffer(7));
+		printContainers(v_buf);
+		TESTED_NAMESPACE::vector<Buffer> v_buf_copy(v_buf.begin() + 10, v_buf.end());
+		v_buf.swap(v_buf_copy);
+		v_buf.erase(v_buf.begin(), v_buf.end() - 2);
+		printContainers(v_buf);
+		std::cout << "live: " << Buffer::live << std::endl;
+	}
+	std::cout << "live after scope: " << Buffer::live << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== mmap allocator =====" << std::endl;
+	{
+		typedef TESTED_NAMESPACE::vector<int, MMAP_ALLOCATOR(int) > mapped_vector;
+		mapped_vector v_mapped;
+		size_t mapped_capacity = v_mapped.capacity();
+		for (int i = 0; i < 20000; ++i) {
+			v_mapped.push_back(i);
+			if (v_mapped.capacity() != mapped_capacity) {
+				mapped_capacity = v_mapped.capacity();
+				bool intact = true;
+				for (int k = 0; k <= i; ++k)
+					intact = intact && v_mapped[k] == k;
+				std::cout << "capacity " << mapped_capacity << ": " << (intact ? "OK" : "KO") << std::endl;
+			}
+		}
+		v_mapped.insert(v_mapped.begin() + 5000, 40000, -1);
+		v_mapped.erase(v_mapped.begin(), v_mapped.begin() + 1000);
+		v_mapped.resize(100000, 3);
+		mapped_vector v_mapped_copy(v_mapped);
+		v_mapped_copy.reserve(300000);
+		long sum = 0;
+		for (size_t k = 0; k < v_mapped_copy.size(); ++k)
+			sum += v_mapped_copy[k];
+		std::cout << "size: " << v_mapped_copy.size() << " sum: " << sum << " equal: " << (v_mapped == v_mapped_copy) << std::endl;
+		mapped_vector v_mapped_small(10, 4);
+		v_mapped_small.swap(v_mapped);
+		v_mapped_small.clear();
+		std::cout << "swapped: " << v_mapped.size() << " " << v_mapped.back() << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== growth policies =====" << std::endl;
+	printGrowth<GROWTH_VECTOR(double_growth)>("double_growth", double_capacities, 100, 300);
+	printGrowth<GROWTH_VECTOR(half_growth)>("half_growth", half_capacities, 100, 300);
+	printGrowth<GROWTH_VECTOR(exact_growth)>("exact_growth", exact_capacities, 10, 10);
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== relational operators =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_lhs(5);
@@ -249,4 +565,18 @@ int main() {
 	std::cout << "operator<=: " << ((v_lhs <= v_rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((v_lhs > v_rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((v_lhs >= v_rhs) ? "OK" : "KO") << std::endl;
+	std::cout << std::endl;
+
+	std::cout << "signed and unsigned orderings..." << std::endl;
+	printCompare<int>("int equal", 100, 7, 100, 0, 0);
+	printCompare<int>("int shorter", 100, 7, 100, 0, 1);
+	printCompare<int>("int negative", 100, 7, 70, -7, 0);
+	printCompare<int>("int byte order", 100, 0x100, 99, 0xff, 0);
+	printCompare<signed char>("signed char", 200, 1, 130, -1, 0);
+	printCompare<unsigned char>("unsigned char", 200, 1, 130, 255, 0);
+	printCompare<unsigned int>("unsigned int", 30, 1, 29, 0x80000000u, 0);
+	printCompare<long long>("long long", 40, -1, 17, -2, 0);
+	printCompare<bool>("bool", 90, true, 80, false, 0);
+	printCompare<double>("double zero", 10, 0.0, 3, -0.0, 0);
+	printCompare<int>("empty", 0, 0, 0, 0, 1);
 }